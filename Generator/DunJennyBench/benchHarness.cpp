@@ -0,0 +1,140 @@
+#include "benchHarness.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	std::atomic<uint64_t> allocations(0);
+	std::atomic<uint64_t> bytes(0);
+	volatile uint64_t sink = 0;
+
+	void* countedAlloc(size_t size)
+	{
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		bytes.fetch_add(size, std::memory_order_relaxed);
+		if (void* p = std::malloc(size ? size : 1))
+			return p;
+		throw std::bad_alloc();
+	}
+}
+
+//Every plain new in the process goes through here so allocations can be counted per op
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+namespace bench {
+
+	uint64_t allocationCount()
+	{
+		return allocations.load(std::memory_order_relaxed);
+	}
+
+	uint64_t allocatedBytes()
+	{
+		return bytes.load(std::memory_order_relaxed);
+	}
+
+	void keep(uint64_t value)
+	{
+		sink = sink + value;
+	}
+
+	bool Harness::enabled(const std::string& name) const
+	{
+		return filter.empty() || name.find(filter) != std::string::npos;
+	}
+
+	void Harness::run(const std::string& name, uint32_t size, const std::function<void()>& op, const std::function<void()>& setup)
+	{
+		if (!enabled(name))
+			return;
+
+		typedef std::chrono::steady_clock clock;
+		auto nanos = [](clock::duration d) { return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count(); };
+
+		//One untimed warm up call also sizes the batches to roughly 10ms each
+		if (setup)
+			setup();
+		auto warmStart = clock::now();
+		op();
+		double single = std::max(1.0, nanos(clock::now() - warmStart));
+		uint64_t batch = std::min<uint64_t>(4096, std::max<uint64_t>(1, (uint64_t)(1e7 / single)));
+
+		Result r;
+		r.name = name;
+		r.size = size;
+
+		double elapsed = 0;
+		uint64_t allocs = 0, allocBytes = 0;
+		while (elapsed < minTimeMs * 1e6 || r.ops == 0)
+		{
+			if (setup)
+				setup();
+
+			uint64_t a0 = allocationCount(), b0 = allocatedBytes();
+			auto t0 = clock::now();
+			for (uint64_t i = 0; i < batch; i++)
+				op();
+			auto t1 = clock::now();
+
+			allocs += allocationCount() - a0;
+			allocBytes += allocatedBytes() - b0;
+			elapsed += nanos(t1 - t0);
+			r.ops += batch;
+		}
+
+		r.nsPerOp = elapsed / r.ops;
+		r.allocsPerOp = (double)allocs / r.ops;
+		r.bytesPerOp = (double)allocBytes / r.ops;
+		results.push_back(r);
+
+		if (progress)
+			printRow(*progress, r);
+	}
+
+	void Harness::printHeader(std::ostream& out)
+	{
+		char line[128];
+		std::snprintf(line, sizeof(line), "%-24s %8s %10s %14s %12s %12s\n", "benchmark", "size", "ops", "ns/op", "allocs/op", "bytes/op");
+		out << line;
+	}
+
+	void Harness::printRow(std::ostream& out, const Result& r)
+	{
+		char line[128];
+		std::snprintf(line, sizeof(line), "%-24s %8u %10llu %14.1f %12.2f %12.1f\n",
+			r.name.c_str(), r.size, (unsigned long long)r.ops, r.nsPerOp, r.allocsPerOp, r.bytesPerOp);
+		out << line << std::flush;
+	}
+
+	void Harness::writeJson(std::ostream& out, const std::string& label) const
+	{
+		//Benchmark names are plain identifiers, only the label can need escaping
+		std::string escaped;
+		for (char c : label)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+
+		out << "{\n  \"label\": \"" << escaped << "\",\n  \"results\": [\n";
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const Result& r = results[i];
+			char line[256];
+			std::snprintf(line, sizeof(line),
+				"    { \"name\": \"%s\", \"size\": %u, \"ops\": %llu, \"nsPerOp\": %.3f, \"allocsPerOp\": %.3f, \"bytesPerOp\": %.1f }%s\n",
+				r.name.c_str(), r.size, (unsigned long long)r.ops, r.nsPerOp, r.allocsPerOp, r.bytesPerOp, i + 1 < results.size() ? "," : "");
+			out << line;
+		}
+		out << "  ]\n}\n";
+	}
+}
@@ -0,0 +1,54 @@
+/// \file benchHarness.h
+/// \breif Times small operations & counts the heap allocations they make
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+#include <cstdint>
+
+//header contents
+namespace bench {
+	struct Result {
+		std::string name;
+		uint32_t size = 0;
+		uint64_t ops = 0;
+		double nsPerOp = 0;
+		double allocsPerOp = 0;
+		double bytesPerOp = 0;
+	};
+
+	//Running totals from the replaced global operator new
+	uint64_t allocationCount();
+	uint64_t allocatedBytes();
+
+	//Stops the optimiser from dropping work whose result is otherwise unused
+	void keep(uint64_t value);
+
+	class Harness {
+	private:
+		std::vector<Result> results;
+		std::string filter;
+		double minTimeMs = 200;
+		std::ostream* progress = nullptr;
+	public:
+		inline void setFilter(std::string f) { filter = std::move(f); }
+		inline void setMinTime(double ms) { minTimeMs = ms; }
+		//Rows are printed here as each benchmark finishes
+		inline void setProgress(std::ostream* out) { progress = out; }
+		inline const std::vector<Result>& getResults() const { return results; }
+
+		bool enabled(const std::string& name) const;
+
+		//Repeats op in batches until minTime has been spent inside it. setup runs
+		//untimed before every batch, its allocations are not counted
+		void run(const std::string& name, uint32_t size, const std::function<void()>& op, const std::function<void()>& setup = nullptr);
+
+		static void printHeader(std::ostream& out);
+		static void printRow(std::ostream& out, const Result& r);
+		void writeJson(std::ostream& out, const std::string& label) const;
+	};
+}
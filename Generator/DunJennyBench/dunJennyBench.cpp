@@ -0,0 +1,311 @@
+//Microbenchmarks for the derivation hot paths, run on synthetic graphs of increasing size
+#include "benchHarness.h"
+#include "workloads.h"
+#include "scaling.h"
+#include "generationStrategy.h"
+#include "layout.h"
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace {
+	using namespace graphSys;
+
+	void printUsage()
+	{
+		std::cerr <<
+			"usage: dunjenny-bench [options]\n"
+			"  --sizes <n,n,...>    graph sizes (default: 10,100,1000,10000,100000)\n"
+			"  --filter <text>      only benchmarks whose name contains text\n"
+			"  --min-time <ms>      time spent in each benchmark (default: 200)\n"
+			"  --json <file>        also write results as json, - for stdout\n"
+			"  --label <text>       label stored in the json, e.g. a commit id\n"
+			"\n"
+			"       dunjenny-bench --scaling [options]\n"
+			"  --sizes <n,n,...>    targetSizeMin values, max is 5x (default: 10,30,100,300,1000)\n"
+			"  --iterations <n,...> maxIterations values (default: 100,1000,10000)\n"
+			"  --runs <n>           derivations per point (default: 5)\n"
+			"  --seed <seed>        first seed (default: 1)\n"
+			"  --search <mode>      greedy, annealing or beam (default: greedy)\n"
+			"  --csv <file>         per point results (default: scaling.csv)\n";
+	}
+
+	std::vector<uint32_t> parseSizes(const std::string& list)
+	{
+		std::vector<uint32_t> sizes;
+		std::stringstream ss(list);
+		std::string item;
+		while (std::getline(ss, item, ','))
+			sizes.push_back((uint32_t)std::stoul(item));
+		return sizes;
+	}
+
+	int runScalingMode(const bench::ScalingOptions& options, const std::string& csvPath)
+	{
+		std::ofstream csv(csvPath);
+		if (!csv)
+		{
+			std::cerr << "dunjenny-bench: could not write " << csvPath << "\n";
+			return 1;
+		}
+
+		RuleFactory rf;
+		bench::addTestRules(rf);
+
+		std::cerr << "scaling sweep, " << searchModeName(options.search.mode) << " search, " << options.runs << " runs per point\n";
+		bench::ScalingReport report = bench::runScaling(rf, options, std::cerr);
+
+		bench::writeScalingCsv(csv, report);
+		bench::printScalingSummary(std::cout, report);
+		return 0;
+	}
+
+	//Benchmarks that do not depend on the graph size
+	void runFixed(bench::Harness& h, const RuleFactory& rf)
+	{
+		const CompiledRule& ruleOne = *rf.getCompiledRules().at(0);
+		std::vector<std::pair<int, int>> newIds;
+		IdAllocator ids;
+
+		//Replaces RuleFactory::generateNewIds, right sides are now instantiated from the compiled template
+		h.run("instantiate", 0, [&] {
+			newIds.clear();
+			ids.reset(500);
+			bench::keep(ruleOne.instantiate(ids, &newIds).nodes.size());
+		});
+
+		//The stock derivation from a single start room
+		Graph start;
+		start.addNode(Node(1, ' ', types::Room));
+		RandomGenerator rng(1);
+		h.run("deriveGraph_start", 1, [&] {
+			GenerationStrategy strat(rf, start, start.getIds(), rng.Split());
+			bench::keep(strat.deriveGraph(start).nodeCount());
+		});
+	}
+
+	void runSized(bench::Harness& h, const RuleFactory& rf, uint32_t n)
+	{
+		const Graph g = bench::makeGraph(n, n);
+		const CompiledRule& ruleThree = *rf.getCompiledRules().at(2);
+
+		//Lookups cycle through a fixed set of random nodes
+		RandomGenerator rng(n);
+		std::vector<Node> picks;
+		for (int i = 0; i < 1024; i++)
+			picks.push_back(g.nodeAtID(rng.GenerateUniform(1, (int)n)));
+		uint32_t k = 0;
+
+		h.run("graph_copy", n, [&] {
+			Graph copy = g;
+			bench::keep(copy.nodeCount());
+		});
+
+		h.run("getConnectedEdges", n, [&] {
+			bench::keep(g.getConnectedEdges(picks[k++ & 1023]).size());
+		});
+
+		h.run("nodeAtID", n, [&] {
+			bench::keep(g.nodeAtID(picks[k++ & 1023].getID()).getID());
+		});
+
+		//Matching keeps per strategy state, so each batch starts from a fresh strategy
+		std::unique_ptr<GenerationStrategy> strat;
+		auto freshStrategy = [&] { strat.reset(new GenerationStrategy(rf, g, g.getIds(), RandomGenerator(n))); };
+
+		h.run("checkLeftNodes", n, [&] {
+			strat->checkLeftNodes(ruleThree, g);
+			bench::keep(strat->getMatches().size());
+		}, freshStrategy);
+
+		h.run("filterNodes", n, [&] {
+			strat->filterNodes(ruleThree, g);
+			bench::keep(strat->getPotentialReplacements().size());
+		}, freshStrategy);
+
+		//Rewrite at a known match and undo it, so every op sees the same graph
+		if (h.enabled("applyRule"))
+		{
+			Graph work = g;
+			SubgraphMatcher matcher(ruleThree.getPlan(), work.getStore(), &rng);
+			std::vector<Match> matches = matcher.findRandom(256);
+			if (!matches.empty())
+			{
+				freshStrategy();
+				h.run("applyRule", n, [&] {
+					work.beginTransaction();
+					bench::keep(strat->applyRule(ruleThree, matches[k++ % matches.size()], work));
+					work.rollback();
+				});
+			}
+		}
+
+		//Grow the synthetic graph by a dungeon's worth of rooms, its nodes already spread past the default distance targets
+		Graph start = g;
+		start.setTargetSizeMin((int)n + 10);
+		start.setTargetSizeMax((int)n + 50);
+		start.setTargetXDistMin(INT_MIN);
+		start.setTargetXDistMax(INT_MAX);
+		start.setTargetYDistMin(INT_MIN);
+		start.setTargetYDistMax(INT_MAX);
+		h.run("deriveGraph", n, [&] {
+			GenerationStrategy derive(rf, start, start.getIds(), rng.Split());
+			bench::keep(derive.deriveGraph(start).nodeCount());
+		});
+
+		//Find a free spot for a room dropped on an existing one, against the spatial hash of the whole graph
+		if (h.enabled("findFreeSpot"))
+		{
+			Graph tracked = g;
+			tracked.trackRooms(FootprintTable());
+			h.run("findFreeSpot", n, [&] {
+				uint32_t slot = (uint32_t)rng.GenerateUniform(0, (int)tracked.nodeCount() - 1);
+				int x = tracked.getStore().nodeXPos(slot), y = tracked.getStore().nodeYPos(slot);
+				bench::keep(tracked.findFreeSpot(types::Room, x, y, 64) ? x : 0);
+			});
+		}
+
+		//One relaxation step per op, on the caller & then over every hardware thread
+		LayoutSettings layout;
+		layout.mode = LayoutMode::Force;
+		layout.iterations = 1;
+		GraphLayout engine;
+		Graph laidOut = g;
+		h.run("forceLayout", n, [&] {
+			engine.run(laidOut, layout);
+			bench::keep(laidOut.calcDistances().first);
+		});
+
+		layout.threads = 0;
+		h.run("forceLayout_mt", n, [&] {
+			engine.run(laidOut, layout);
+			bench::keep(laidOut.calcDistances().first);
+		});
+
+		//Whole layered layout per op, it has no iterations to split
+		layout.mode = LayoutMode::Layered;
+		h.run("layeredLayout", n, [&] {
+			engine.run(laidOut, layout);
+			bench::keep(laidOut.calcDistances().first);
+		});
+
+		//Packs every room of the graph, the rooms are left where they are so each op sees the same input
+		FootprintTable footprints;
+		h.run("embedRooms", n, [&] {
+			bench::keep(embedRooms(g.getStore(), footprints, 0, 0, 8).rooms.size());
+		});
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::vector<uint32_t> sizes = { 10, 100, 1000, 10000, 100000 };
+	std::string jsonPath, label;
+	bench::Harness h;
+
+	bool scaling = false, sizesGiven = false;
+	bench::ScalingOptions scalingOptions;
+	std::string csvPath = "scaling.csv";
+
+	try
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			auto next = [&]() -> std::string {
+				if (i + 1 >= argc)
+					throw std::invalid_argument(arg + " needs a value");
+				return argv[++i];
+			};
+
+			if (arg == "-h" || arg == "--help")
+			{
+				printUsage();
+				return 0;
+			}
+			else if (arg == "--sizes")
+			{
+				sizes = parseSizes(next());
+				sizesGiven = true;
+			}
+			else if (arg == "--filter")
+				h.setFilter(next());
+			else if (arg == "--min-time")
+				h.setMinTime(std::stod(next()));
+			else if (arg == "--json")
+				jsonPath = next();
+			else if (arg == "--label")
+				label = next();
+			else if (arg == "--scaling")
+				scaling = true;
+			else if (arg == "--iterations")
+			{
+				scalingOptions.maxIterations.clear();
+				for (uint32_t n : parseSizes(next()))
+					scalingOptions.maxIterations.push_back((int)n);
+			}
+			else if (arg == "--runs")
+				scalingOptions.runs = (uint32_t)std::stoul(next());
+			else if (arg == "--seed")
+				scalingOptions.seed = std::stoull(next());
+			else if (arg == "--search")
+			{
+				std::string mode = next();
+				if (!searchModeFromName(mode, scalingOptions.search.mode))
+					throw std::invalid_argument("unknown search " + mode);
+			}
+			else if (arg == "--csv")
+				csvPath = next();
+			else
+				throw std::invalid_argument("unknown option " + arg);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "dunjenny-bench: " << e.what() << "\n";
+		printUsage();
+		return 1;
+	}
+
+	if (scaling)
+	{
+		if (sizesGiven)
+		{
+			scalingOptions.targetSizes.clear();
+			for (uint32_t n : sizes)
+				scalingOptions.targetSizes.push_back((int)n);
+		}
+		return runScalingMode(scalingOptions, csvPath);
+	}
+
+	//Keep stdout clean when the json goes there
+	std::ostream& table = jsonPath == "-" ? std::cerr : std::cout;
+	h.setProgress(&table);
+	bench::Harness::printHeader(table);
+
+	RuleFactory rf;
+	bench::addTestRules(rf);
+
+	runFixed(h, rf);
+	for (uint32_t n : sizes)
+	{
+		if (n > 0)
+			runSized(h, rf, n);
+	}
+
+	if (jsonPath == "-")
+		h.writeJson(std::cout, label);
+	else if (!jsonPath.empty())
+	{
+		std::ofstream out(jsonPath);
+		if (!out)
+		{
+			std::cerr << "dunjenny-bench: could not write " << jsonPath << "\n";
+			return 1;
+		}
+		h.writeJson(out, label);
+	}
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include "memoryStats.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <string>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace bench {
+
+#if defined(_WIN32)
+	uint64_t peakRssKb()
+	{
+		PROCESS_MEMORY_COUNTERS counters;
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return 0;
+		return (uint64_t)counters.PeakWorkingSetSize / 1024;
+	}
+
+	bool resetPeakRss()
+	{
+		return false;
+	}
+#elif defined(__linux__)
+	uint64_t peakRssKb()
+	{
+		std::ifstream status("/proc/self/status");
+		std::string line;
+		while (std::getline(status, line))
+		{
+			if (line.compare(0, 6, "VmHWM:") == 0)
+				return std::stoull(line.substr(6));
+		}
+		return 0;
+	}
+
+	bool resetPeakRss()
+	{
+		//Writing 5 resets VmHWM to the current RSS, available since Linux 4.0
+		std::ofstream clearRefs("/proc/self/clear_refs");
+		clearRefs << "5";
+		clearRefs.flush();
+		return (bool)clearRefs;
+	}
+#else
+	uint64_t peakRssKb()
+	{
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+#if defined(__APPLE__)
+		return (uint64_t)usage.ru_maxrss / 1024;
+#else
+		return (uint64_t)usage.ru_maxrss;
+#endif
+	}
+
+	bool resetPeakRss()
+	{
+		return false;
+	}
+#endif
+}
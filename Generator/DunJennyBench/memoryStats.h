@@ -0,0 +1,17 @@
+/// \file memoryStats.h
+/// \breif Peak resident set size of the running process
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <cstdint>
+
+//header contents
+namespace bench {
+	//High water mark in KiB, 0 when the platform can't report it
+	uint64_t peakRssKb();
+
+	//Starts a new high water mark from the current size. Returns false where the
+	//platform can't do this, the peak is then for the whole process so far
+	bool resetPeakRss();
+}
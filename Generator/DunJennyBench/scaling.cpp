@@ -0,0 +1,154 @@
+#include "scaling.h"
+#include "memoryStats.h"
+#include "batchGenerator.h"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace {
+	//Slope of the least squares line through (log x, log y), pairs with a non-positive value are skipped
+	double fitLogLog(const std::vector<std::pair<double, double>>& samples)
+	{
+		double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+		for (const auto& s : samples)
+		{
+			if (s.first <= 0 || s.second <= 0)
+				continue;
+			double x = std::log(s.first), y = std::log(s.second);
+			n++;
+			sx += x;
+			sy += y;
+			sxx += x * x;
+			sxy += x * y;
+		}
+
+		double denom = n * sxx - sx * sx;
+		if (n < 2 || denom == 0)
+			return std::numeric_limits<double>::quiet_NaN();
+		return (n * sxy - sx * sy) / denom;
+	}
+}
+
+namespace bench {
+
+	ScalingReport runScaling(const graphSys::RuleFactory& rf, const ScalingOptions& options, std::ostream& progress)
+	{
+		ScalingReport report;
+		std::vector<std::pair<double, double>> timeSamples, stepSamples;
+
+		graphSys::Graph start;
+		start.addNode(graphSys::Node(1, ' ', graphSys::types::Room));
+
+		for (int maxIterations : options.maxIterations)
+		{
+			//Local slopes compare against the previous point in this series
+			ScalingPoint previous;
+			bool hasPrevious = false;
+			for (int targetSize : options.targetSizes)
+			{
+				graphSys::BatchSettings settings;
+				settings.firstSeed = options.seed;
+				settings.seedCount = options.runs;
+				settings.threads = 1;
+				settings.keepGraphs = false;
+				settings.targetSizeMin = { targetSize, targetSize };
+				settings.targetSizeMax = { targetSize * 5, targetSize * 5 };
+				settings.maxIterations = { maxIterations, maxIterations };
+				settings.targetXDistMin = { -options.maxDistance, -options.maxDistance };
+				settings.targetXDistMax = { options.maxDistance, options.maxDistance };
+				settings.targetYDistMin = { -options.maxDistance, -options.maxDistance };
+				settings.targetYDistMax = { options.maxDistance, options.maxDistance };
+				settings.search = options.search;
+
+				report.perPointRss = resetPeakRss() && report.perPointRss;
+
+				graphSys::BatchGenerator batch;
+				batch.run(rf, start, settings);
+
+				ScalingPoint p;
+				p.targetSizeMin = targetSize;
+				p.targetSizeMax = targetSize * 5;
+				p.maxIterations = maxIterations;
+				p.runs = options.runs;
+				p.peakRssKb = peakRssKb();
+
+				uint32_t succeeded = 0;
+				for (const graphSys::BatchResult& r : batch.getResults())
+				{
+					double ms = r.genTimeMicros / 1000.0;
+					p.meanTimeMs += ms;
+					p.meanIterations += r.iterations;
+					p.meanSize += r.size;
+					succeeded += r.success;
+
+					timeSamples.push_back(std::pair<double, double>(r.size, ms));
+					if (r.iterations > 0)
+						stepSamples.push_back(std::pair<double, double>(r.size, ms / r.iterations));
+				}
+
+				size_t count = batch.getResults().size();
+				if (count > 0)
+				{
+					p.meanTimeMs /= count;
+					p.meanIterations /= count;
+					p.meanSize /= count;
+					p.successRate = (double)succeeded / count;
+				}
+
+				p.localExponent = std::numeric_limits<double>::quiet_NaN();
+				if (hasPrevious)
+					p.localExponent = fitLogLog({ { previous.meanSize, previous.meanTimeMs }, { p.meanSize, p.meanTimeMs } });
+
+				report.points.push_back(p);
+				previous = p;
+				hasPrevious = true;
+				progress << "  target " << p.targetSizeMin << "/" << p.targetSizeMax << ", " << p.maxIterations << " iterations: "
+					<< p.meanTimeMs << " ms\n" << std::flush;
+			}
+		}
+
+		report.timeExponent = fitLogLog(timeSamples);
+		report.stepExponent = fitLogLog(stepSamples);
+		return report;
+	}
+
+	void writeScalingCsv(std::ostream& out, const ScalingReport& report)
+	{
+		out << "targetSizeMin,targetSizeMax,maxIterations,runs,meanTimeMs,meanIterations,meanSize,successRate,peakRssKb,localExponent\n";
+		for (const ScalingPoint& p : report.points)
+		{
+			out << p.targetSizeMin << ',' << p.targetSizeMax << ',' << p.maxIterations << ',' << p.runs << ','
+				<< p.meanTimeMs << ',' << p.meanIterations << ',' << p.meanSize << ',' << p.successRate << ',' << p.peakRssKb << ',';
+			if (!std::isnan(p.localExponent))
+				out << p.localExponent;
+			out << '\n';
+		}
+	}
+
+	void printScalingSummary(std::ostream& out, const ScalingReport& report)
+	{
+		char line[160];
+		std::snprintf(line, sizeof(line), "%12s %10s %12s %10s %10s %8s %10s %8s\n",
+			"target", "max iters", "ms/graph", "iters", "size", "success", "peak MB", "local k");
+		out << line;
+
+		for (const ScalingPoint& p : report.points)
+		{
+			char target[32], local[16];
+			std::snprintf(target, sizeof(target), "%d/%d", p.targetSizeMin, p.targetSizeMax);
+			if (std::isnan(p.localExponent))
+				std::snprintf(local, sizeof(local), "-");
+			else
+				std::snprintf(local, sizeof(local), "%.2f", p.localExponent);
+
+			std::snprintf(line, sizeof(line), "%12s %10d %12.3f %10.1f %10.1f %7.0f%% %10.1f %8s\n",
+				target, p.maxIterations, p.meanTimeMs, p.meanIterations, p.meanSize, p.successRate * 100, p.peakRssKb / 1024.0, local);
+			out << line;
+		}
+
+		std::snprintf(line, sizeof(line), "\ntime per graph ~ size^%.2f, time per step ~ size^%.2f\n", report.timeExponent, report.stepExponent);
+		out << line;
+		if (!report.perPointRss)
+			out << "peak MB is the process high water mark, this platform can't reset it between points\n";
+	}
+}
@@ -0,0 +1,53 @@
+/// \file scaling.h
+/// \breif Sweeps target size & iteration limits and fits how generation cost grows
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "ruleFactory.h"
+#include "searchPolicy.h"
+#include <ostream>
+
+//header contents
+namespace bench {
+	struct ScalingOptions {
+		//targetSizeMin values, targetSizeMax is five times each like the stock 10/50
+		std::vector<int> targetSizes = { 10, 30, 100, 300, 1000 };
+		std::vector<int> maxIterations = { 100, 1000, 10000 };
+		uint32_t runs = 5;
+		uint64_t seed = 1;
+		//Node spread grows with the target size, so the distance window is opened this wide to time size alone
+		int maxDistance = 1 << 30;
+		graphSys::SearchSettings search;
+	};
+
+	struct ScalingPoint {
+		int targetSizeMin = 0;
+		int targetSizeMax = 0;
+		int maxIterations = 0;
+		uint32_t runs = 0;
+		double meanTimeMs = 0;
+		double meanIterations = 0;
+		double meanSize = 0;
+		double successRate = 0;
+		uint64_t peakRssKb = 0;
+		//Slope of log time over log size from the previous point with the same maxIterations
+		double localExponent = 0;
+	};
+
+	struct ScalingReport {
+		std::vector<ScalingPoint> points;
+		//Least squares fit over every run, time ~ size^k
+		double timeExponent = 0;
+		//Same fit for the cost of a single derivation step
+		double stepExponent = 0;
+		//False when peak RSS is for the whole process rather than each point
+		bool perPointRss = true;
+	};
+
+	//Runs each point one derivation at a time so timings & memory are not shared
+	ScalingReport runScaling(const graphSys::RuleFactory& rf, const ScalingOptions& options, std::ostream& progress);
+
+	void writeScalingCsv(std::ostream& out, const ScalingReport& report);
+	void printScalingSummary(std::ostream& out, const ScalingReport& report);
+}
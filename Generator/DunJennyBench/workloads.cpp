@@ -0,0 +1,61 @@
+#include "workloads.h"
+
+namespace {
+	using namespace graphSys;
+
+	//Chain of count nodes with ids first, first + 1, ...
+	Components chain(int first, int count)
+	{
+		Components c;
+		for (int i = 0; i < count; i++)
+			c.nodes.push_back(Node(first + i, ' ', types::Room));
+		for (int i = 1; i < count; i++)
+			c.edges.push_back(Edge(c.nodes[i - 1], c.nodes[i]));
+		return c;
+	}
+
+	Rule makeRule(const std::string& id, Components left, Components right)
+	{
+		Rule r(std::move(left), std::move(right));
+		r.setID(id);
+		return r;
+	}
+}
+
+namespace bench {
+
+	graphSys::Graph makeGraph(uint32_t n, uint64_t seed)
+	{
+		RandomGenerator rng(seed);
+		graphSys::Graph g;
+		std::vector<graphSys::Node> nodes;
+		nodes.reserve(n);
+
+		for (uint32_t i = 0; i < n; i++)
+		{
+			graphSys::Node node((int)i + 1, ' ', graphSys::types::Room);
+			node.setXPos(rng.GenerateGaussian(0, 500));
+			node.setYPos(rng.GenerateGaussian(0, 500));
+			nodes.push_back(node);
+			g.addNode(node);
+		}
+
+		for (uint32_t i = 1; i < n; i++)
+		{
+			uint32_t parent = i - 1;
+			if (rng.GenerateUniform(0, 7) == 0)
+				parent = (uint32_t)rng.GenerateUniform(0, (int)i - 1);
+			g.addEdge(graphSys::Edge(nodes[parent], nodes[i]));
+		}
+		return g;
+	}
+
+	void addTestRules(graphSys::RuleFactory& rf)
+	{
+		std::vector<Rule> rules;
+		rules.push_back(makeRule("RuleOne", chain(1, 1), chain(2, 5)));
+		rules.push_back(makeRule("RuleTwo", chain(1, 2), chain(3, 3)));
+		rules.push_back(makeRule("RuleThree", chain(1, 3), chain(4, 4)));
+		rf.setRules(std::move(rules));
+	}
+}
@@ -0,0 +1,16 @@
+/// \file workloads.h
+/// \breif Synthetic graphs & the stock rule set used by the benchmarks
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "ruleFactory.h"
+
+//header contents
+namespace bench {
+	//A path of n rooms with ids 1..n, roughly one node in eight branches off an earlier node
+	graphSys::Graph makeGraph(uint32_t n, uint64_t seed);
+
+	//The three rules GraphBuilder::testRules sets up, with fixed ids so runs are comparable
+	void addTestRules(graphSys::RuleFactory& rf);
+}
@@ -0,0 +1,216 @@
+//Headless entry point, runs a batch of derivations and writes graphs & stats to disk
+#include "ruleSetLoader.h"
+#define PICOJSON_USE_LOCALE 0
+#include "picojson.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <chrono>
+
+namespace json = picojson;
+namespace fs = std::filesystem;
+
+namespace {
+	void printUsage()
+	{
+		std::cerr <<
+			"usage: dunjenny-cli <rules.json> [options]\n"
+			"  -o, --out <dir>      output directory (default: out)\n"
+			"  -n, --count <n>      number of seeds to derive\n"
+			"  -s, --seed <seed>    first seed\n"
+			"  -t, --threads <n>    worker threads, 0 for all cores\n"
+			"      --search <mode>  greedy, annealing or beam\n"
+			"      --layout <mode>  none, force or layered\n"
+			"      --no-graphs      write stats only\n"
+			"  -q, --quiet          no summary on stdout\n"
+			"Options override the file's \"parameters\" block.\n";
+	}
+
+	//Same layout the loader reads, so a written graph can be used as a start graph
+	json::value graphToJson(const graphSys::BatchResult& result)
+	{
+		json::array nodes;
+		for (const graphSys::Node& n : result.graph.nodes())
+		{
+			json::object node;
+			node["id"] = json::value((double)n.getID());
+			node["type"] = json::value(n.getTypeName());
+			node["label"] = json::value(std::string(1, n.getLabel()));
+			node["x"] = json::value((double)n.getXPos());
+			node["y"] = json::value((double)n.getYPos());
+			nodes.push_back(json::value(node));
+		}
+
+		json::array edges;
+		for (const graphSys::Edge& e : result.graph.edges())
+		{
+			json::object edge;
+			edge["src"] = json::value((double)e.getSrc().getID());
+			edge["trg"] = json::value((double)e.getTarget().getID());
+			edge["type"] = json::value(graphSys::TypeRegistry::name(e.getType()));
+			edges.push_back(json::value(edge));
+		}
+
+		json::object graph;
+		graph["seed"] = json::value((double)result.seed);
+		graph["success"] = json::value(result.success);
+		graph["iterations"] = json::value((double)result.iterations);
+		graph["nodes"] = json::value(nodes);
+		graph["edges"] = json::value(edges);
+
+		//Packed room rectangles by top left corner, only when the layout embedded them
+		if (!result.rooms.rooms.empty())
+		{
+			json::array rooms;
+			for (const graphSys::RoomPlacement& r : result.rooms.rooms)
+			{
+				json::object room;
+				room["id"] = json::value((double)r.id);
+				room["type"] = json::value(graphSys::TypeRegistry::name(r.type));
+				room["x"] = json::value((double)r.x);
+				room["y"] = json::value((double)r.y);
+				room["width"] = json::value((double)r.width);
+				room["height"] = json::value((double)r.height);
+				rooms.push_back(json::value(room));
+			}
+			json::object embedding;
+			embedding["width"] = json::value((double)result.rooms.width);
+			embedding["height"] = json::value((double)result.rooms.height);
+			embedding["unplaced"] = json::value((double)result.rooms.unplaced);
+			embedding["rooms"] = json::value(rooms);
+			graph["embedding"] = json::value(embedding);
+		}
+		return json::value(graph);
+	}
+
+	void writeStats(const fs::path& path, const std::vector<graphSys::BatchResult>& results)
+	{
+		std::ofstream out(path);
+		out << "seed,success,size,iterations,timeMicros,targetSizeMin,targetSizeMax,"
+			"targetXDistMin,targetXDistMax,targetYDistMin,targetYDistMax,maxIterations,layoutTimeMicros\n";
+		for (const graphSys::BatchResult& r : results)
+		{
+			const graphSys::BatchParams& p = r.params;
+			out << r.seed << ',' << r.success << ',' << r.size << ',' << r.iterations << ',' << r.genTimeMicros << ','
+				<< p.targetSizeMin << ',' << p.targetSizeMax << ',' << p.targetXDistMin << ',' << p.targetXDistMax << ','
+				<< p.targetYDistMin << ',' << p.targetYDistMax << ',' << p.maxIterations << ',' << r.layoutTimeMicros << '\n';
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string rulesPath;
+	fs::path outDir = "out";
+	bool quiet = false;
+
+	//Overrides are applied after the file is loaded
+	long long count = -1, seed = -1, threads = -1;
+	std::string search;
+	std::string layout;
+	bool noGraphs = false;
+
+	try
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			auto next = [&]() -> std::string {
+				if (i + 1 >= argc)
+					throw std::invalid_argument(arg + " needs a value");
+				return argv[++i];
+			};
+
+			if (arg == "-h" || arg == "--help")
+			{
+				printUsage();
+				return 0;
+			}
+			else if (arg == "-o" || arg == "--out")
+				outDir = next();
+			else if (arg == "-n" || arg == "--count")
+				count = std::stoll(next());
+			else if (arg == "-s" || arg == "--seed")
+				seed = std::stoll(next());
+			else if (arg == "-t" || arg == "--threads")
+				threads = std::stoll(next());
+			else if (arg == "--search")
+				search = next();
+			else if (arg == "--layout")
+				layout = next();
+			else if (arg == "--no-graphs")
+				noGraphs = true;
+			else if (arg == "-q" || arg == "--quiet")
+				quiet = true;
+			else if (rulesPath.empty() && arg[0] != '-')
+				rulesPath = arg;
+			else
+				throw std::invalid_argument("unknown option " + arg);
+		}
+		if (rulesPath.empty())
+			throw std::invalid_argument("no rule set given");
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "dunjenny-cli: " << e.what() << "\n";
+		printUsage();
+		return 1;
+	}
+
+	try
+	{
+		graphSys::RuleSet set = graphSys::loadRuleSet(rulesPath);
+		graphSys::BatchSettings& settings = set.settings;
+		if (count >= 0)
+			settings.seedCount = (uint32_t)count;
+		if (seed >= 0)
+			settings.firstSeed = (uint64_t)seed;
+		if (threads >= 0)
+			settings.threads = (unsigned)threads;
+		if (noGraphs)
+			settings.keepGraphs = false;
+		if (!search.empty() && !graphSys::searchModeFromName(search, settings.search.mode))
+			throw std::invalid_argument("unknown search " + search);
+		if (!layout.empty() && !graphSys::layoutModeFromName(layout, settings.layout.mode))
+			throw std::invalid_argument("unknown layout " + layout);
+
+		graphSys::RuleFactory rf;
+		rf.setRules(std::move(set.rules));
+
+		auto preGenTime = std::chrono::steady_clock::now();
+		graphSys::BatchGenerator batch;
+		batch.run(rf, set.startGraph, settings);
+		auto postGenTime = std::chrono::steady_clock::now();
+
+		const std::vector<graphSys::BatchResult>& results = batch.getResults();
+		fs::create_directories(outDir);
+		writeStats(outDir / "stats.csv", results);
+
+		if (settings.keepGraphs)
+		{
+			fs::create_directories(outDir / "graphs");
+			for (const graphSys::BatchResult& r : results)
+			{
+				std::ofstream out(outDir / "graphs" / ("graph_" + std::to_string(r.seed) + ".json"));
+				out << graphToJson(r).serialize(true);
+			}
+		}
+
+		if (!quiet)
+		{
+			size_t succeeded = 0;
+			for (const graphSys::BatchResult& r : results)
+				succeeded += r.success;
+
+			auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(postGenTime - preGenTime).count();
+			std::cout << set.name << ": " << succeeded << "/" << results.size() << " graphs succeeded in "
+				<< duration << " ms on " << batch.getThreadCount() << " threads, written to " << outDir.string() << "\n";
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "dunjenny-cli: " << e.what() << "\n";
+		return 1;
+	}
+	return 0;
+}
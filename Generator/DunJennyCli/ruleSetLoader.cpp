@@ -0,0 +1,353 @@
+#include "ruleSetLoader.h"
+#define PICOJSON_USE_LOCALE 0
+#include "picojson.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace json = picojson;
+
+namespace {
+	using namespace graphSys;
+
+	const json::value& member(const json::object& obj, const std::string& key)
+	{
+		static const json::value missing;
+		auto it = obj.find(key);
+		return it == obj.end() ? missing : it->second;
+	}
+
+	int toInt(const json::value& v, const std::string& what)
+	{
+		if (!v.is<double>())
+			throw std::runtime_error(what + " must be a number");
+		return (int)v.get<double>();
+	}
+
+	//Either a bare id or { "id", "type", "label", "x", "y" }, only the id is required
+	Node parseNode(const json::value& v)
+	{
+		if (v.is<double>())
+			return Node(toInt(v, "node id"), ' ');
+		if (!v.is<json::object>())
+			throw std::runtime_error("node must be an id or an object");
+
+		const json::object& obj = v.get<json::object>();
+		Node n(toInt(member(obj, "id"), "node id"), ' ');
+
+		const json::value& type = member(obj, "type");
+		if (type.is<std::string>())
+			n.setType(TypeRegistry::intern(type.get<std::string>()));
+
+		const json::value& label = member(obj, "label");
+		if (label.is<std::string>() && !label.get<std::string>().empty())
+			n.setLabel(label.get<std::string>()[0]);
+
+		if (!member(obj, "x").is<json::null>())
+			n.setXPos(toInt(member(obj, "x"), "node x"));
+		if (!member(obj, "y").is<json::null>())
+			n.setYPos(toInt(member(obj, "y"), "node y"));
+		return n;
+	}
+
+	const Node& findNode(const std::vector<Node>& nodes, int id)
+	{
+		for (const Node& n : nodes)
+		{
+			if (n.getID() == id)
+				return n;
+		}
+		throw std::runtime_error("edge refers to unknown node " + std::to_string(id));
+	}
+
+	//Either [src, trg] or { "src", "trg", "type" }, endpoints are ids on the same side
+	Edge parseEdge(const json::value& v, const std::vector<Node>& nodes)
+	{
+		if (v.is<json::array>())
+		{
+			const json::array& ends = v.get<json::array>();
+			if (ends.size() != 2)
+				throw std::runtime_error("edge must be [src, trg]");
+			return Edge(findNode(nodes, toInt(ends[0], "edge src")), findNode(nodes, toInt(ends[1], "edge trg")));
+		}
+		if (!v.is<json::object>())
+			throw std::runtime_error("edge must be [src, trg] or an object");
+
+		const json::object& obj = v.get<json::object>();
+		Edge e(findNode(nodes, toInt(member(obj, "src"), "edge src")), findNode(nodes, toInt(member(obj, "trg"), "edge trg")));
+
+		const json::value& type = member(obj, "type");
+		if (type.is<std::string>())
+			e.setType(TypeRegistry::intern(type.get<std::string>()));
+		return e;
+	}
+
+	Components parseComponents(const json::value& v, const std::string& what)
+	{
+		Components c;
+		if (v.is<json::null>())
+			return c;
+		if (!v.is<json::object>())
+			throw std::runtime_error(what + " must be an object");
+
+		const json::object& obj = v.get<json::object>();
+		const json::value& nodes = member(obj, "nodes");
+		const json::value& edges = member(obj, "edges");
+
+		if (nodes.is<json::array>())
+		{
+			for (const json::value& n : nodes.get<json::array>())
+				c.nodes.push_back(parseNode(n));
+		}
+		else if (!nodes.is<json::null>())
+			throw std::runtime_error(what + " nodes must be an array");
+
+		if (edges.is<json::array>())
+		{
+			for (const json::value& e : edges.get<json::array>())
+				c.edges.push_back(parseEdge(e, c.nodes));
+		}
+		else if (!edges.is<json::null>())
+			throw std::runtime_error(what + " edges must be an array");
+		return c;
+	}
+
+	Rule parseRule(const json::value& v)
+	{
+		if (!v.is<json::object>())
+			throw std::runtime_error("rule must be an object");
+
+		const json::object& obj = v.get<json::object>();
+		const json::value& id = member(obj, "id");
+		if (!id.is<std::string>())
+			throw std::runtime_error("rule id must be a string");
+
+		const std::string& ruleId = id.get<std::string>();
+		Rule r(parseComponents(member(obj, "left"), ruleId + " left"), parseComponents(member(obj, "right"), ruleId + " right"));
+		r.setID(ruleId);
+		return r;
+	}
+
+	//A single value fixes the parameter, [min, max] draws it per seed
+	void parseRange(const json::object& params, const std::string& key, ParamRange& range)
+	{
+		const json::value& v = member(params, key);
+		if (v.is<json::null>())
+			return;
+
+		if (v.is<double>())
+		{
+			range.min = range.max = toInt(v, key);
+			return;
+		}
+		if (v.is<json::array>() && v.get<json::array>().size() == 2)
+		{
+			range.min = toInt(v.get<json::array>()[0], key);
+			range.max = toInt(v.get<json::array>()[1], key);
+			if (range.min > range.max)
+				throw std::runtime_error(key + " range is reversed");
+			return;
+		}
+		throw std::runtime_error(key + " must be a number or [min, max]");
+	}
+
+	//Either a mode name or { "mode", "temperature", "cooling", "warming", "beamWidth", "beamExpansions" }
+	void parseSearch(const json::value& v, SearchSettings& search)
+	{
+		if (v.is<json::null>())
+			return;
+
+		const json::value& mode = v.is<json::object>() ? member(v.get<json::object>(), "mode") : v;
+		if (!mode.is<std::string>() || !searchModeFromName(mode.get<std::string>(), search.mode))
+			throw std::runtime_error("search mode must be greedy, annealing or beam");
+		if (!v.is<json::object>())
+			return;
+
+		const json::object& obj = v.get<json::object>();
+		auto number = [&](const std::string& key, double& out) {
+			const json::value& n = member(obj, key);
+			if (n.is<json::null>())
+				return;
+			if (!n.is<double>())
+				throw std::runtime_error("search " + key + " must be a number");
+			out = n.get<double>();
+		};
+		double beamWidth = search.beamWidth, beamExpansions = search.beamExpansions;
+		number("temperature", search.initialTemperature);
+		number("cooling", search.cooling);
+		number("warming", search.warming);
+		number("beamWidth", beamWidth);
+		number("beamExpansions", beamExpansions);
+		if (beamWidth < 1 || beamExpansions < 1)
+			throw std::runtime_error("search beamWidth & beamExpansions must be at least 1");
+		search.beamWidth = (uint32_t)beamWidth;
+		search.beamExpansions = (uint32_t)beamExpansions;
+	}
+
+	//Either a mode name or { "mode", "iterations", "edgeLength", "theta", "gravity",
+	//"incremental", "localHops", "localIterations", "localMaxNodes", "layeredSweeps",
+	//"avoidOverlap", "nudgeTries", "spacing", "footprints": { "<type>": [width, height] },
+	//"embed", "embedWidth", "embedHeight", "embedGroupSize" }
+	void parseLayout(const json::value& v, LayoutSettings& layout)
+	{
+		if (v.is<json::null>())
+			return;
+
+		const json::value& mode = v.is<json::object>() ? member(v.get<json::object>(), "mode") : v;
+		if (!mode.is<std::string>() || !layoutModeFromName(mode.get<std::string>(), layout.mode))
+			throw std::runtime_error("layout mode must be none, force or layered");
+		if (!v.is<json::object>())
+			return;
+
+		const json::object& obj = v.get<json::object>();
+		auto number = [&](const std::string& key, double& out) {
+			const json::value& n = member(obj, key);
+			if (n.is<json::null>())
+				return;
+			if (!n.is<double>())
+				throw std::runtime_error("layout " + key + " must be a number");
+			out = n.get<double>();
+		};
+		double iterations = layout.iterations, localHops = layout.localHops;
+		double localIterations = layout.localIterations, localMaxNodes = layout.localMaxNodes;
+		double layeredSweeps = layout.layeredSweeps, nudgeTries = layout.nudgeTries;
+		double spacing = layout.footprints.getSpacing();
+		double embedWidth = layout.embedWidth, embedHeight = layout.embedHeight, embedGroupSize = layout.embedGroupSize;
+		number("iterations", iterations);
+		number("edgeLength", layout.edgeLength);
+		number("theta", layout.theta);
+		number("gravity", layout.gravity);
+		number("localHops", localHops);
+		number("localIterations", localIterations);
+		number("localMaxNodes", localMaxNodes);
+		number("layeredSweeps", layeredSweeps);
+		number("nudgeTries", nudgeTries);
+		number("spacing", spacing);
+		number("embedWidth", embedWidth);
+		number("embedHeight", embedHeight);
+		number("embedGroupSize", embedGroupSize);
+		if (iterations < 0 || layout.edgeLength <= 0 || layout.theta < 0 || layout.gravity < 0)
+			throw std::runtime_error("layout edgeLength must be positive, iterations, theta & gravity not negative");
+		if (localHops < 0 || localIterations < 0 || localMaxNodes < 1 || layeredSweeps < 0 || nudgeTries < 0 || spacing < 0)
+			throw std::runtime_error("layout localHops, localIterations, layeredSweeps, nudgeTries & spacing must not be negative, localMaxNodes at least 1");
+		layout.iterations = (uint32_t)iterations;
+		layout.localHops = (uint32_t)localHops;
+		layout.localIterations = (uint32_t)localIterations;
+		layout.localMaxNodes = (uint32_t)localMaxNodes;
+		layout.layeredSweeps = (uint32_t)layeredSweeps;
+		layout.nudgeTries = (uint32_t)nudgeTries;
+		layout.footprints.setSpacing((int)spacing);
+		if (embedWidth < 0 || embedHeight < 0 || embedGroupSize < 1)
+			throw std::runtime_error("layout embedWidth & embedHeight must not be negative, embedGroupSize at least 1");
+		layout.embedWidth = (int)embedWidth;
+		layout.embedHeight = (int)embedHeight;
+		layout.embedGroupSize = (uint32_t)embedGroupSize;
+
+		auto flag = [&](const std::string& key, bool& out) {
+			const json::value& b = member(obj, key);
+			if (b.is<bool>())
+				out = b.get<bool>();
+			else if (!b.is<json::null>())
+				throw std::runtime_error("layout " + key + " must be true or false");
+		};
+		flag("incremental", layout.incremental);
+		flag("avoidOverlap", layout.avoidOverlap);
+		flag("embed", layout.embed);
+
+		const json::value& footprints = member(obj, "footprints");
+		if (footprints.is<json::object>())
+		{
+			for (const auto& entry : footprints.get<json::object>())
+			{
+				const json::value& size = entry.second;
+				if (!size.is<json::array>() || size.get<json::array>().size() != 2)
+					throw std::runtime_error("layout footprint " + entry.first + " must be [width, height]");
+				Footprint fp = { toInt(size.get<json::array>()[0], "footprint width"), toInt(size.get<json::array>()[1], "footprint height") };
+				if (fp.width < 1 || fp.height < 1)
+					throw std::runtime_error("layout footprint " + entry.first + " must be at least 1 x 1");
+				layout.footprints.set(TypeRegistry::intern(entry.first), fp);
+			}
+		}
+		else if (!footprints.is<json::null>())
+			throw std::runtime_error("layout footprints must be an object");
+	}
+
+	void parseSettings(const json::value& v, BatchSettings& settings)
+	{
+		if (v.is<json::null>())
+			return;
+		if (!v.is<json::object>())
+			throw std::runtime_error("parameters must be an object");
+
+		const json::object& obj = v.get<json::object>();
+		if (!member(obj, "seed").is<json::null>())
+			settings.firstSeed = (uint64_t)toInt(member(obj, "seed"), "seed");
+		if (!member(obj, "count").is<json::null>())
+			settings.seedCount = (uint32_t)toInt(member(obj, "count"), "count");
+		if (!member(obj, "threads").is<json::null>())
+			settings.threads = (unsigned)toInt(member(obj, "threads"), "threads");
+		if (member(obj, "keepGraphs").is<bool>())
+			settings.keepGraphs = member(obj, "keepGraphs").get<bool>();
+
+		parseRange(obj, "targetSizeMin", settings.targetSizeMin);
+		parseRange(obj, "targetSizeMax", settings.targetSizeMax);
+		parseRange(obj, "targetXDistMin", settings.targetXDistMin);
+		parseRange(obj, "targetXDistMax", settings.targetXDistMax);
+		parseRange(obj, "targetYDistMin", settings.targetYDistMin);
+		parseRange(obj, "targetYDistMax", settings.targetYDistMax);
+		parseRange(obj, "maxIterations", settings.maxIterations);
+		parseSearch(member(obj, "search"), settings.search);
+		parseLayout(member(obj, "layout"), settings.layout);
+	}
+}
+
+namespace graphSys {
+
+	RuleSet loadRuleSet(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw std::runtime_error(path + ": could not open file");
+
+		std::stringstream text;
+		text << file.rdbuf();
+
+		json::value root;
+		std::string err = json::parse(root, text.str());
+		if (!err.empty())
+			throw std::runtime_error(path + ": " + err);
+
+		RuleSet set;
+		try
+		{
+			if (!root.is<json::object>())
+				throw std::runtime_error("top level must be an object");
+			const json::object& obj = root.get<json::object>();
+
+			const json::value& name = member(obj, "name");
+			set.name = name.is<std::string>() ? name.get<std::string>() : path;
+
+			const json::value& rules = member(obj, "rules");
+			if (!rules.is<json::array>() || rules.get<json::array>().empty())
+				throw std::runtime_error("rules must be a non-empty array");
+			for (const json::value& r : rules.get<json::array>())
+				set.rules.push_back(parseRule(r));
+
+			Components start = parseComponents(member(obj, "start"), "start");
+			if (start.nodes.empty())
+				start.nodes.push_back(Node(1, ' ', types::Room));
+			for (const Node& n : start.nodes)
+				set.startGraph.addNode(n);
+			for (const Edge& e : start.edges)
+				set.startGraph.addEdge(e);
+			set.startGraph.setName(set.name);
+
+			parseSettings(member(obj, "parameters"), set.settings);
+		}
+		catch (const std::runtime_error& e)
+		{
+			throw std::runtime_error(path + ": " + e.what());
+		}
+		return set;
+	}
+}
@@ -0,0 +1,21 @@
+/// \file ruleSetLoader.h
+/// \breif Reads a rule set, start graph & batch parameters from a json file
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "batchGenerator.h"
+
+//header contents
+namespace graphSys {
+	struct RuleSet {
+		std::string name;
+		std::vector<Rule> rules;
+		//A single room node unless the file gives one
+		Graph startGraph;
+		BatchSettings settings;
+	};
+
+	//Throws std::runtime_error naming the file & the problem when it can't be loaded
+	RuleSet loadRuleSet(const std::string& path);
+}
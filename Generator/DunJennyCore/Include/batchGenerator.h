@@ -0,0 +1,85 @@
+/// \file batchGenerator.h
+/// \breif Derives one graph per seed over a thread pool and keeps per-graph stats
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "generationStrategy.h"
+#include "threadPool.h"
+#include "layout.h"
+#include <memory>
+
+//header contents
+namespace graphSys {
+	//Inclusive range a parameter is drawn from for each job
+	struct ParamRange {
+		int min;
+		int max;
+	};
+
+	//Values actually used for one job, drawn from the settings ranges
+	struct BatchParams {
+		int targetSizeMin = 10;
+		int targetSizeMax = 50;
+		int targetXDistMin = -1000;
+		int targetXDistMax = 1000;
+		int targetYDistMin = -1000;
+		int targetYDistMax = 1000;
+		int maxIterations = 100;
+	};
+
+	struct BatchSettings {
+		//Jobs use seeds firstSeed .. firstSeed + seedCount - 1
+		uint64_t firstSeed = 0;
+		uint32_t seedCount = 1;
+		//0 uses every hardware thread
+		unsigned threads = 0;
+		//Keep a snapshot of each finished graph, turn off for large sweeps
+		bool keepGraphs = true;
+
+		ParamRange targetSizeMin{ 10, 10 };
+		ParamRange targetSizeMax{ 50, 50 };
+		ParamRange targetXDistMin{ -1000, -1000 };
+		ParamRange targetXDistMax{ 1000, 1000 };
+		ParamRange targetYDistMin{ -1000, -1000 };
+		ParamRange targetYDistMax{ 1000, 1000 };
+		ParamRange maxIterations{ 100, 100 };
+
+		//Same search for every job
+		SearchSettings search;
+		//Applied to each derived graph, a job lays out on its own thread whatever layout.threads says
+		LayoutSettings layout;
+	};
+
+	struct BatchResult {
+		uint64_t seed = 0;
+		BatchParams params;
+		long long genTimeMicros = 0;
+		long long layoutTimeMicros = 0;
+		int iterations = 0;
+		bool success = false;
+		uint32_t size = 0;
+		GraphSnapshot graph;
+		//Kept with the graph when layout.embed is set
+		RoomEmbedding rooms;
+	};
+
+	class BatchGenerator {
+	private:
+		std::unique_ptr<ThreadPool> pool;
+		std::vector<BatchResult> results;
+
+		BatchResult runJob(const RuleFactory& rf, const Graph& startGraph, const BatchSettings& settings, uint64_t seed) const;
+	public:
+		BatchGenerator();
+		~BatchGenerator();
+
+		//Appends one result per seed, in seed order. Each job's randomness comes only
+		//from its seed so the results do not depend on the thread count
+		void run(const RuleFactory& rf, const Graph& startGraph, const BatchSettings& settings);
+
+		inline const std::vector<BatchResult>& getResults() const { return results; }
+		inline void clearResults() { results.clear(); }
+		inline unsigned getThreadCount() const { return pool ? pool->size() : 0; }
+	};
+}
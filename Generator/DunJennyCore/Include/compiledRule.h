@@ -0,0 +1,55 @@
+/// \file compiledRule.h
+/// \breif Rules compiled once into an immutable match plan & right hand side template
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "matcher.h"
+#include "idAllocator.h"
+#include <memory>
+
+//header contents
+namespace graphSys {
+	//Right hand side records, edge endpoints index into the template's node list
+	struct TemplateNode {
+		int ruleId;
+		char label;
+		TypeAtom type;
+	};
+
+	struct TemplateEdge {
+		uint32_t src;
+		uint32_t trg;
+		TypeAtom type;
+	};
+
+	//Never modified after construction so one instance can be shared by every
+	//derivation & thread using the rule set
+	class CompiledRule {
+	private:
+		Rule source;
+
+		SearchPlan plan;
+		std::vector<SearchPlan> rootedPlans;
+
+		std::vector<TemplateNode> rightNodes;
+		std::vector<TemplateEdge> rightEdges;
+	public:
+		explicit CompiledRule(const Rule& rule);
+		~CompiledRule();
+
+		//Right side with one id drawn from ids per node in template order, freed ids included when it
+		//recycles. newIds receives (rule node id, new id) pairs when given
+		Components instantiate(IdAllocator& ids, std::vector<std::pair<int, int>>* newIds = nullptr) const;
+
+		inline const Rule& getRule() const { return source; }
+		inline const std::string& getID() const { return source.getID(); }
+		inline const SearchPlan& getPlan() const { return plan; }
+		//Plan rooted at each left node, in left node order
+		inline const std::vector<SearchPlan>& getRootedPlans() const { return rootedPlans; }
+		inline const std::vector<TemplateNode>& getRightNodes() const { return rightNodes; }
+		inline const std::vector<TemplateEdge>& getRightEdges() const { return rightEdges; }
+	};
+
+	typedef std::shared_ptr<const CompiledRule> CompiledRulePtr;
+}
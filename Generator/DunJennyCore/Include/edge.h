@@ -0,0 +1,31 @@
+/// \file edge.h
+/// \breif	 
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "node.h"
+
+//header contents
+namespace graphSys {
+	class Edge {
+	private:
+		Node srcNode;
+		Node targetNode;
+		TypeAtom edgeType = types::Default;
+		bool autoIdGen = false;
+	public:
+		Edge();
+		Edge(Node srcNode, Node targetNode, TypeAtom edgeType = types::Default);
+		~Edge();
+
+		inline const Node& getSrc() const { return srcNode; }
+		inline void setSrc(const Node& source) { srcNode = source; }
+		inline const Node& getTarget() const { return targetNode; }
+		inline void setTarget(const Node& target) { targetNode = target; }
+		inline TypeAtom getType() const { return edgeType; }
+		inline void setType(TypeAtom type) { edgeType = type; }
+		inline void setAutoID(bool gen) { autoIdGen = gen; }
+		inline bool getAutoID() const { return autoIdGen; }
+	};
+}
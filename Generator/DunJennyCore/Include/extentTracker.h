@@ -0,0 +1,135 @@
+/// \file extentTracker.h
+/// \breif Bounding box of a graph's live nodes, kept up to date as nodes are added & removed
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "persistentArray.h"
+#include <algorithm>
+#include <functional>
+
+//header contents
+namespace graphSys {
+	//Binary heap with lazy deletion. An erased value waits in a second heap and both are
+	//popped together once it reaches the top, so top() stays O(1) and updates O(log n).
+	//Both heaps are persistent arrays, copying one shares its chunks like the graph store does
+	template<typename Compare>
+	class LazyHeap {
+	private:
+		PersistentArray<int> heap;
+		PersistentArray<int> erased;
+
+		static void pushTo(PersistentArray<int>& h, int value)
+		{
+			Compare before;
+			uint32_t i = h.size();
+			h.push_back(value);
+			while (i > 0)
+			{
+				uint32_t parent = (i - 1) / 2;
+				if (!before(h[parent], value))
+					break;
+				h.set(i, h[parent]);
+				i = parent;
+			}
+			h.set(i, value);
+		}
+
+		static void popFrom(PersistentArray<int>& h)
+		{
+			Compare before;
+			int value = h.back();
+			h.pop_back();
+			uint32_t n = h.size();
+			if (n == 0)
+				return;
+
+			uint32_t i = 0;
+			while (2 * i + 1 < n)
+			{
+				uint32_t child = 2 * i + 1;
+				if (child + 1 < n && before(h[child], h[child + 1]))
+					child++;
+				if (!before(value, h[child]))
+					break;
+				h.set(i, h[child]);
+				i = child;
+			}
+			h.set(i, value);
+		}
+
+		//Keeps the top live & drops erased entries once they outnumber the live ones
+		void prune()
+		{
+			while (!erased.empty() && heap[0] == erased[0])
+			{
+				popFrom(heap);
+				popFrom(erased);
+			}
+
+			if (erased.size() > 32 && erased.size() * 2 > heap.size())
+			{
+				std::vector<int> all, gone, live;
+				all.reserve(heap.size());
+				for (uint32_t i = 0; i < heap.size(); i++)
+					all.push_back(heap[i]);
+				gone.reserve(erased.size());
+				for (uint32_t i = 0; i < erased.size(); i++)
+					gone.push_back(erased[i]);
+
+				std::sort(all.begin(), all.end());
+				std::sort(gone.begin(), gone.end());
+				std::set_difference(all.begin(), all.end(), gone.begin(), gone.end(), std::back_inserter(live));
+				std::make_heap(live.begin(), live.end(), Compare());
+
+				heap.clear();
+				erased.clear();
+				for (int value : live)
+					heap.push_back(value);
+			}
+		}
+	public:
+		inline void push(int value) { pushTo(heap, value); prune(); }
+		//value must currently be held, erasing one that is not corrupts the heap
+		inline void erase(int value) { pushTo(erased, value); prune(); }
+		inline void clear() { heap.clear(); erased.clear(); }
+		//Replaces the contents in O(n) rather than n pushes
+		void assign(std::vector<int> values)
+		{
+			std::make_heap(values.begin(), values.end(), Compare());
+			clear();
+			for (int value : values)
+				heap.push_back(value);
+		}
+
+		inline uint32_t size() const { return heap.size() - erased.size(); }
+		inline bool empty() const { return size() == 0; }
+		inline int top() const { return heap[0]; }
+	};
+
+	struct Extent {
+		int minX = 0;
+		int maxX = 0;
+		int minY = 0;
+		int maxY = 0;
+	};
+
+	class ExtentTracker {
+	private:
+		LazyHeap<std::greater<int>> minX;
+		LazyHeap<std::less<int>> maxX;
+		LazyHeap<std::greater<int>> minY;
+		LazyHeap<std::less<int>> maxY;
+	public:
+		void add(int x, int y);
+		void remove(int x, int y);
+		void clear();
+		//Holds exactly the given positions, for moving every node at once
+		void assign(const std::vector<int>& xs, const std::vector<int>& ys);
+
+		inline uint32_t size() const { return maxX.size(); }
+		inline bool empty() const { return maxX.empty(); }
+		//All zero while no node is held
+		Extent extent() const;
+	};
+}
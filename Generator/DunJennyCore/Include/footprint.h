@@ -0,0 +1,37 @@
+/// \file footprint.h
+/// \breif Width & height of the room each node type stands for
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "typeRegistry.h"
+#include <vector>
+
+//header contents
+namespace graphSys {
+	struct Footprint {
+		int width;
+		int height;
+	};
+
+	//Types without a footprint of their own use the fallback
+	class FootprintTable {
+	private:
+		std::vector<Footprint> sizes;
+		std::vector<bool> given;
+		Footprint fallback = { 80, 80 };
+		//Clear space kept between neighbouring rooms
+		int spacing = 20;
+	public:
+		//Rooms 80 x 80, start & end 60 x 60
+		FootprintTable();
+
+		void set(TypeAtom type, Footprint size);
+		Footprint get(TypeAtom type) const;
+		inline void setFallback(Footprint size) { fallback = size; }
+		inline void setSpacing(int gap) { spacing = gap; }
+		inline int getSpacing() const { return spacing; }
+		//Widest or tallest footprint, spacing included
+		int largest() const;
+	};
+}
@@ -0,0 +1,50 @@
+/// \file forceLayout.h
+/// \breif Force-directed node placement with a Barnes-Hut quadtree for the repulsion
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "layout.h"
+#include <vector>
+
+//header contents
+namespace graphSys {
+	//Quadtree over a set of points, each cell holds its bodies' total mass & centre of mass.
+	//Rebuilt from scratch every iteration, a build is O(N log N)
+	class BarnesHutTree {
+	private:
+		struct Cell {
+			double cx, cy, half;
+			double comX, comY;
+			double mass;
+			//Bodies in order[first, first + count)
+			uint32_t first, count;
+			//First of four consecutive children, npos for a leaf
+			uint32_t child;
+		};
+
+		std::vector<Cell> cells;
+		std::vector<uint32_t> order;
+		const double* xs = nullptr;
+		const double* ys = nullptr;
+
+		void split(uint32_t cell, uint32_t depth);
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		void build(const std::vector<double>& x, const std::vector<double>& y);
+		//Push on body i from every other body with strength k2 / distance, far cells approximated by their centre of mass
+		void repulsion(uint32_t i, double theta, double k2, double& fx, double& fy) const;
+
+		inline size_t cellCount() const { return cells.size(); }
+		//Bodies in tree order, neighbours in space sit close together
+		inline const std::vector<uint32_t>& bodies() const { return order; }
+	};
+
+	//Relaxes every node of G from its current position. Nodes are split over pool when one is given,
+	//each node's move only reads the previous iteration so the result does not depend on the thread count
+	void forceLayout(Graph& G, const LayoutSettings& settings, ThreadPool* pool = nullptr);
+	//Relaxes the nodes within localHops of seeds & leaves the rest of G where it is.
+	//Costs O(localIterations * m²) for the m nodes involved, whatever the size of G. Returns the slots it moved
+	std::vector<uint32_t> localLayout(Graph& G, const std::vector<uint32_t>& seeds, const LayoutSettings& settings);
+}
@@ -0,0 +1,98 @@
+/// \file generationStrategy.h
+/// \breif	 
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "rule.h"
+#include "ruleFactory.h"
+#include "matchNetwork.h"
+#include "stopToken.h"
+#include "searchPolicy.h"
+#include "layout.h"
+
+//header contents
+namespace graphSys {
+	class GenerationStrategy {
+	protected:
+		RuleFactory RF;
+		RandomGenerator RG;
+		std::vector<CompiledRulePtr> rules;
+		Graph graph;
+		Graph Fail;
+		std::vector<std::pair<int, int>> ids;
+		std::vector<Node> matchedLeftNodes;
+		std::vector<Edge> matchedLeftEdges;
+		std::unordered_map<int, Node> matches;
+		std::vector<int> mappedIDs;
+		//Graph slots matched to the current rule's left nodes
+		Match leftMatch;
+		Node initialNode;
+		Edge initialEdge;
+
+		bool rewrite(const CompiledRule& rule, Graph& graph);
+
+		std::vector<std::pair<TypeAtom, TypeAtom>> graphEdgeMap;
+		std::vector<Rule> potentialReplacements;
+
+		MatchNetwork network;
+
+		//One snapshot per accepted derivation step, only kept when asked for. A live snapshot
+		//makes the next write to each column clone its chunk table, runs that never replay the steps skip it
+		bool keepHistory = false;
+		std::vector<GraphSnapshot> history;
+		//Node count after the last kept step, 0 before any
+		uint32_t lastKeptSize = 0;
+
+		//Checked once per iteration, deriveGraph gives up with the FAIL graph when set
+		StopToken stop;
+
+		//How deriveGraph picks & keeps steps, greedy unless set
+		SearchSettings search;
+
+		//Only layout.incremental is used here, the full layout runs once a graph is derived
+		LayoutSettings layout;
+		void placeProduction(Components& production, const Components& replaced);
+
+		//What a derivation step does with the rewrite it just made
+		enum class StepOutcome { Done, Keep, Drop, Undo };
+		StepOutcome greedyStep(Graph& G, int graphSize, std::pair<int, int> dist);
+		StepOutcome annealingStep(Graph& G, std::pair<int, int> dist, double& energy, double temperature);
+		Graph deriveBeam(Graph G);
+		void addStartAndEnd(Graph& G);
+
+	public:
+		GenerationStrategy();
+		GenerationStrategy(const RuleFactory& rf, const Graph& startGraph, const std::vector<std::pair<int, int>>& ids/*, std::vector<Node> nonTerminals, int avgDerivations*/);
+		//All randomness in the derivation comes from rng, so a seeded rng reproduces the graph
+		GenerationStrategy(const RuleFactory& rf, const Graph& startGraph, const std::vector<std::pair<int, int>>& ids, const RandomGenerator& rng);
+		~GenerationStrategy();
+		std::vector<std::pair<TypeAtom, TypeAtom>> getGraphEdges();
+		void checkLeftNodes(const CompiledRule& rule, const Graph& G);
+		void checkLeftEdges(const Graph& G);
+		void filterNodes(const CompiledRule& rule, const Graph& G);
+		void useMatch(const CompiledRule& rule, const Match& match, const Graph& G);
+		void queueReplacement(const CompiledRule& rule, const Graph& G);
+		Components addProduction(const Components& rightSide);
+		bool applyRule(const CompiledRule& rule, Graph& graph);
+		//Apply at a match that is already known, e.g. one held by the match network
+		bool applyRule(const CompiledRule& rule, const Match& match, Graph& graph);
+		Graph deriveGraph(Graph G);
+
+		inline const std::vector<Rule>& getPotentialReplacements() const { return potentialReplacements; }
+		inline const std::vector<Node>& getMatches() const { return matchedLeftNodes; }
+		inline const std::vector<GraphSnapshot>& getHistory() const { return history; }
+		inline void setKeepHistory(bool keep) { keepHistory = keep; }
+		inline uint32_t getLastKeptSize() const { return lastKeptSize; }
+		inline void setStopToken(StopToken token) { stop = std::move(token); }
+		inline const SearchSettings& getSearch() const { return search; }
+		inline void setSearch(const SearchSettings& settings) { search = settings; }
+		inline const LayoutSettings& getLayout() const { return layout; }
+		inline void setLayout(const LayoutSettings& settings) { layout = settings; }
+		//inline Graph updateGraph() { return graph; }
+
+		std::pair<int, int> lastPos = std::pair<int, int>(100,100);
+		std::vector<std::pair<int, int>> matchingNodes;
+		graphSys::Components leftSide;
+	};
+}
@@ -0,0 +1,212 @@
+/// \file graph.h
+/// \breif	 
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "rule.h"
+#include "graphStore.h"
+#include "graphView.h"
+#include "extentTracker.h"
+#include "idAllocator.h"
+#include "footprint.h"
+#include "spatialHash.h"
+#include "randomGenerator.h"
+
+//header contents
+namespace graphSys {
+	//Bookkeeping that is not touched while matching or rewriting the graph
+	struct GraphMeta {
+		std::string name;
+
+		std::vector<std::string> nodeList;
+		std::vector<std::string> edgeList;
+
+		std::vector<std::pair<int, int>> ids;
+
+		Rule updatedRule;
+		std::vector<std::string> rulesApplied;
+	};
+
+	//Node that was placed or lifted while a transaction was open, undone on rollback
+	struct PlacementChange {
+		bool added;
+		int id;
+		TypeAtom type;
+		int x, y;
+	};
+
+	//Metadata saved when a transaction opens, topology changes live in the store's undo log
+	struct GraphCheckpoint {
+		int iteration = 0;
+		std::vector<PlacementChange> placements;
+		std::vector<std::pair<int, int>> ids;
+		IdAllocator nodeIds;
+		Rule updatedRule;
+	};
+
+	//Read-only copy of one derivation state. The store shares its chunks with the
+	//graph it came from so taking one costs O(1) regardless of graph size
+	class GraphSnapshot {
+	private:
+		GraphStore store;
+		std::string name;
+		int iteration = 0;
+		bool completed = false;
+		size_t rulesApplied = 0;
+
+		friend class Graph;
+	public:
+		inline NodeView nodes() const { return NodeView(store); }
+		inline EdgeView edges() const { return EdgeView(store); }
+		inline uint32_t nodeCount() const { return store.nodeCount(); }
+		inline uint32_t edgeCount() const { return store.edgeCount(); }
+		inline const GraphStore& getStore() const { return store; }
+
+		inline const std::string& getName() const { return name; }
+		inline int getIteration() const { return iteration; }
+		inline bool isCompleted() const { return completed; }
+		inline size_t getRulesAppliedCount() const { return rulesApplied; }
+	};
+
+	class Graph {
+	private:
+		GraphStore store;
+		GraphMeta meta;
+		GraphCheckpoint checkpoint;
+		//Bounding box of the live nodes, follows every add, delete & rollback
+		ExtentTracker extent;
+		//Room footprints of the live nodes, only kept once trackRooms is called
+		bool trackingRooms = false;
+		FootprintTable footprints;
+		SpatialHash rooms;
+		//Ids for nodes added by derivation, stays past every id the graph has held
+		IdAllocator nodeIds;
+
+		void trackPlacement(int id, TypeAtom type, int x, int y, bool added);
+
+		int targetSizeMin = 10;
+		int targetSizeMax = 50;
+
+		int targetXDistMin = -1000;
+		int targetYDistMin = -1000;
+		int targetXDistMax = 1000;
+		int targetYDistMax = 1000;
+
+		int minXDist = -1000;
+		int minYDist = -1000;
+		int maxXDist = 1000;
+		int maxYDist = 1000;
+
+	public:
+		int iteration;
+		int maxIterations = 100;
+
+		Node nullNode;
+		bool completed = false;
+		Graph();
+		Graph(const Graph&) = default;
+		Graph(Graph&&) = default;
+		Graph& operator=(const Graph&) = default;
+		Graph& operator=(Graph&&) = default;
+		~Graph();
+
+		void addNode(const Node& n);
+		void delNode(std::vector<Node>& nodeVec, size_t pos);
+		void delNode(std::vector<Node>& nodeVec);
+		void addEdge(const Edge& e);
+		void delEdge(std::vector<Edge>&	 edgeVec);
+		//Moves the node in slot, the extent & an open transaction follow it
+		void setNodePosition(uint32_t slot, int x, int y);
+		//Position of every node, in slot order
+		void setNodePositions(const std::vector<int>& xs, const std::vector<int>& ys);
+
+		//Keep a spatial hash of every node's room so placement can avoid overlaps, copies of the graph keep it too
+		void trackRooms(const FootprintTable& table);
+		void stopTrackingRooms();
+		inline bool isTrackingRooms() const { return trackingRooms; }
+		inline const SpatialHash& getRooms() const { return rooms; }
+		RoomRect roomRect(TypeAtom type, int x, int y) const;
+		//Moves x, y to the nearest spot where a room of type overlaps none but ignoreId's.
+		//False when no spot within tries is free or rooms are not tracked
+		bool findFreeSpot(TypeAtom type, int& x, int& y, uint32_t tries, int ignoreId = -1) const;
+		//Moves the node in slot off any room it overlaps, true when it ends up clear
+		bool nudgeNode(uint32_t slot, uint32_t tries);
+		std::vector<Edge> getConnectedEdges(const Node& n) const;
+		bool hasSource(const Node& n) const;
+		bool hasTarget(const Node& n) const;
+		bool containsNode(const Node& n) const;
+		void clearGraph();
+
+		//Apply a rule in place and keep or undo it without copying the graph
+		void beginTransaction();
+		void commit();
+		void rollback();
+		inline bool inTransaction() const { return store.inTransaction(); }
+
+		GraphSnapshot snapshot() const;
+		//Copy that shares no storage with this graph, safe to hand to another thread
+		Graph deepCopy() const;
+		std::vector<std::string> printGraph(std::vector<std::pair<int, int>> ids);
+		std::vector<std::string> printGraphNodes(std::vector < std::pair<int, int>> ids);
+		Node nodeAtID(int id) const;
+		Node nodeWithLabel(char label) const;
+		bool matchEdge(Edge* one);
+		Node randomMatch(const Node& n, RandomGenerator& rg) const;
+		
+		inline void updateRule(Rule r) { meta.updatedRule = std::move(r); }
+		inline const Rule& getUpdatedRule() const { return meta.updatedRule; }
+		inline void addRuleApplied(std::string rule) { meta.rulesApplied.push_back(std::move(rule)); }
+		inline const std::vector<std::string>& getGeneratedRules() const { return meta.rulesApplied; }
+		inline void clearGeneratedRules() { meta.rulesApplied.clear(); }
+
+		//Read-only views, prefer these over the copying getters below
+		inline NodeView nodes() const { return NodeView(store); }
+		inline EdgeView edges() const { return EdgeView(store); }
+		inline uint32_t nodeCount() const { return store.nodeCount(); }
+		inline uint32_t edgeCount() const { return store.edgeCount(); }
+		inline const GraphStore& getStore() const { return store; }
+
+		//Materialise the whole node/edge list
+		std::vector<Node> getGraphNodes() const;
+		std::vector<Edge> getGraphEdges() const;
+		inline const std::vector<std::string>& getNodeList() const { return meta.nodeList; }
+		inline const std::vector<std::string>& getEdgeList() const { return meta.edgeList; }
+
+		inline int* getTargetSizeMin() { return &targetSizeMin; };
+		inline int* getTargetSizeMax() { return &targetSizeMax; };
+		inline void setTargetSizeMin(int tSize) { targetSizeMin = tSize; }
+		inline void setTargetSizeMax(int tSize) { targetSizeMax = tSize; }
+
+		inline int* getTargetXDistMin() { return &targetXDistMin; };
+		inline int* getTargetXDistMax() { return &targetXDistMax; };
+
+		inline int* getTargetYDistMin() { return &targetYDistMin; };
+		inline int* getTargetYDistMax() { return &targetYDistMax; };
+
+		inline void setTargetXDistMin(int tXMin) { targetXDistMin = tXMin; }
+		inline void setTargetXDistMax(int tXMax) { targetXDistMax = tXMax; }
+
+		inline void setTargetYDistMin(int tYMin) { targetYDistMin = tYMin; }
+		inline void setTargetYDistMax(int tYMax) { targetYDistMax = tYMax; }
+
+		//Furthest any live node reaches along x & y, O(1)
+		std::pair<int, int> calcDistances() const;
+		inline Extent getExtent() const { return extent.extent(); }
+
+		inline void setNextNodeId(int id) { nodeIds.reset(id); }
+		inline int getNextNodeId() const { return nodeIds.peek(); }
+		//Off by default, when on the ids of deleted nodes are handed out again
+		inline void setIdRecycling(bool on) { nodeIds.setRecycling(on); }
+		inline IdAllocator& getNodeIds() { return nodeIds; }
+		inline const IdAllocator& getNodeIds() const { return nodeIds; }
+		inline void setIds(std::vector<std::pair<int, int>> newIds) { meta.ids = std::move(newIds); }
+		inline const std::vector<std::pair<int, int>>& getIds() const { return meta.ids; }
+
+		inline void setMaxIter(int max) { maxIterations = max; }
+
+		inline const std::string& getName() const { return meta.name; }
+		inline void setName(std::string n) { meta.name = std::move(n); }
+
+	};
+}
\ No newline at end of file
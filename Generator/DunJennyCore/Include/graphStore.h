@@ -0,0 +1,161 @@
+/// \file graphStore.h
+/// \breif Structure-of-arrays storage for graph topology
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "edge.h"
+#include "typeRegistry.h"
+#include "idIndex.h"
+#include "persistentArray.h"
+#include <cstdint>
+
+//header contents
+namespace graphSys {
+	//Node attributes held column by column, indexed by dense node slot.
+	//Columns are copy-on-write so copies of a store share unchanged chunks
+	struct NodeColumns {
+		PersistentArray<int> ids;
+		PersistentArray<TypeAtom> types;
+		PersistentArray<char> labels;
+		PersistentArray<int> xPos;
+		PersistentArray<int> yPos;
+
+		//Heads of each node's outgoing & incoming edge chains
+		PersistentArray<uint32_t> firstOut;
+		PersistentArray<uint32_t> firstIn;
+
+		//Position of each node inside its type bucket
+		PersistentArray<uint32_t> typePos;
+	};
+
+	//Edge endpoints refer to node slots rather than embedding node copies
+	struct EdgeColumns {
+		PersistentArray<uint32_t> src;
+		PersistentArray<uint32_t> trg;
+		PersistentArray<TypeAtom> types;
+		PersistentArray<uint8_t> autoId;
+
+		//Doubly linked incidence chains threaded through the edge slots
+		PersistentArray<uint32_t> nextOut;
+		PersistentArray<uint32_t> prevOut;
+		PersistentArray<uint32_t> nextIn;
+		PersistentArray<uint32_t> prevIn;
+	};
+
+	//One mutation recorded while a transaction is open, removals keep
+	//enough state to put the element back into its exact slot & chain position
+	struct UndoRecord {
+		enum Kind : uint8_t {
+			NodeAdded,
+			NodeRemoved,
+			EdgeAdded,
+			EdgeRemoved,
+			//Only the position changed, xPos & yPos hold the old one
+			NodeMoved
+		};
+		Kind kind;
+		uint32_t slot;
+
+		int id;
+		TypeAtom type;
+		char label;
+		int xPos, yPos;
+		bool indexed;
+		uint32_t typePos;
+
+		uint32_t src, trg;
+		uint8_t autoId;
+		uint32_t prevOut, nextOut, prevIn, nextIn;
+	};
+
+	class GraphStore {
+	private:
+		NodeColumns nodes;
+		EdgeColumns edges;
+
+		IdIndex index;
+		//Nodes whose id was already taken, these are not in the index
+		uint32_t duplicateIds = 0;
+
+		//Node slots grouped by type atom so matching can skip nodes of other types
+		std::vector<PersistentArray<uint32_t>> typeBuckets;
+
+		bool recording = false;
+		std::vector<UndoRecord> undoLog;
+		uint32_t baseNodeCount = 0;
+
+		void appendNodeSlot();
+		void bucketInsert(uint32_t slot, uint32_t pos);
+		uint32_t bucketErase(uint32_t slot);
+		void appendEdgeSlot();
+		void moveNode(uint32_t from, uint32_t to);
+		void linkEdge(uint32_t e);
+		void unlinkEdge(uint32_t e);
+		void moveEdge(uint32_t from, uint32_t to);
+		void restoreNode(const UndoRecord& rec);
+		void restoreEdge(const UndoRecord& rec);
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		GraphStore();
+		GraphStore(const GraphStore&) = default;
+		GraphStore(GraphStore&&) = default;
+		GraphStore& operator=(const GraphStore&) = default;
+		GraphStore& operator=(GraphStore&&) = default;
+		~GraphStore();
+
+		uint32_t addNode(const Node& n);
+		void removeNode(uint32_t slot);
+		uint32_t addEdge(uint32_t src, uint32_t trg, TypeAtom type, bool autoId = false);
+		void removeEdge(uint32_t e);
+		void setNodePosition(uint32_t slot, int x, int y);
+		void clear();
+
+		//Mutations between begin and commit/rollback are logged so they can be
+		//undone in time proportional to the change
+		void beginTransaction();
+		void commit();
+		void rollback();
+		inline bool inTransaction() const { return recording; }
+		inline size_t pendingChanges() const { return undoLog.size(); }
+		//Changes made since beginTransaction, in the order they happened
+		inline const std::vector<UndoRecord>& changes() const { return undoLog; }
+		inline uint32_t nodeCountAtBegin() const { return baseNodeCount; }
+
+		uint32_t findNode(int id) const;
+		uint32_t findEdge(int srcId, int trgId) const;
+		bool hasEdge(uint32_t src, uint32_t trg) const;
+
+		Node node(uint32_t slot) const;
+		Edge edge(uint32_t e) const;
+
+		inline uint32_t nodeCount() const { return (uint32_t)nodes.ids.size(); }
+		inline uint32_t edgeCount() const { return (uint32_t)edges.src.size(); }
+
+		inline int nodeId(uint32_t slot) const { return nodes.ids[slot]; }
+		inline TypeAtom nodeType(uint32_t slot) const { return nodes.types[slot]; }
+		inline char nodeLabel(uint32_t slot) const { return nodes.labels[slot]; }
+		inline int nodeXPos(uint32_t slot) const { return nodes.xPos[slot]; }
+		inline int nodeYPos(uint32_t slot) const { return nodes.yPos[slot]; }
+
+		inline uint32_t edgeSrc(uint32_t e) const { return edges.src[e]; }
+		inline uint32_t edgeTarget(uint32_t e) const { return edges.trg[e]; }
+		inline TypeAtom edgeType(uint32_t e) const { return edges.types[e]; }
+		inline bool edgeAutoID(uint32_t e) const { return edges.autoId[e] != 0; }
+
+		//Type index, order within a bucket is arbitrary
+		inline uint32_t typeCount(TypeAtom type) const { return type < typeBuckets.size() ? typeBuckets[type].size() : 0; }
+		inline uint32_t nodeOfType(TypeAtom type, uint32_t i) const { return typeBuckets[type][i]; }
+
+		//Incidence chains, each walk is O(degree) and ends at npos
+		inline uint32_t firstOutEdge(uint32_t slot) const { return nodes.firstOut[slot]; }
+		inline uint32_t nextOutEdge(uint32_t e) const { return edges.nextOut[e]; }
+		inline uint32_t firstInEdge(uint32_t slot) const { return nodes.firstIn[slot]; }
+		inline uint32_t nextInEdge(uint32_t e) const { return edges.nextIn[e]; }
+
+		//Raw columns, every one of a kind holds exactly nodeCount or edgeCount entries
+		inline const NodeColumns& nodeColumns() const { return nodes; }
+		inline const EdgeColumns& edgeColumns() const { return edges; }
+	};
+}
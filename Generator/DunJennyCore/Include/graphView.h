@@ -0,0 +1,52 @@
+/// \file graphView.h
+/// \breif Read-only ranges over a GraphStore that build values on demand
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "graphStore.h"
+#include <iterator>
+
+//header contents
+namespace graphSys {
+	//Nodes and edges are small value types, so a view hands out copies
+	//without ever materialising a container
+	template <typename T, T (GraphStore::*Get)(uint32_t) const, uint32_t (GraphStore::*Count)() const>
+	class StoreView {
+	private:
+		const GraphStore* store;
+	public:
+		class iterator {
+		private:
+			const GraphStore* store;
+			uint32_t pos;
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const T* pointer;
+			typedef T reference;
+
+			iterator(const GraphStore* s, uint32_t p) : store(s), pos(p) {}
+
+			inline T operator*() const { return (store->*Get)(pos); }
+			inline iterator& operator++() { pos++; return *this; }
+			inline iterator operator++(int) { iterator it = *this; pos++; return it; }
+			inline bool operator==(const iterator& other) const { return pos == other.pos; }
+			inline bool operator!=(const iterator& other) const { return pos != other.pos; }
+		};
+
+		explicit StoreView(const GraphStore& s) : store(&s) {}
+
+		inline iterator begin() const { return iterator(store, 0); }
+		inline iterator end() const { return iterator(store, size()); }
+		inline uint32_t size() const { return (store->*Count)(); }
+		inline bool empty() const { return size() == 0; }
+		inline T operator[](uint32_t i) const { return (store->*Get)(i); }
+		inline T front() const { return (store->*Get)(0); }
+		inline T back() const { return (store->*Get)(size() - 1); }
+	};
+
+	typedef StoreView<Node, &GraphStore::node, &GraphStore::nodeCount> NodeView;
+	typedef StoreView<Edge, &GraphStore::edge, &GraphStore::edgeCount> EdgeView;
+}
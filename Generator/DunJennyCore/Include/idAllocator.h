@@ -0,0 +1,35 @@
+/// \file idAllocator.h
+/// \breif Hands out dense node ids, counting up from a base with optional reuse of freed ids
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <cstdint>
+#include <vector>
+
+//header contents
+namespace graphSys {
+	class IdAllocator {
+	private:
+		int32_t next;
+		bool recycling = false;
+		//Released ids, reused newest first while recycling is on
+		std::vector<int32_t> freed;
+	public:
+		explicit IdAllocator(int32_t first = 1);
+		~IdAllocator();
+
+		int32_t allocate();
+		//Only kept when recycling, the id must no longer be in use
+		void release(int32_t id);
+		//Moves past an id chosen elsewhere, e.g. by the editor, so it is never handed out again
+		void observe(int32_t id);
+		void reset(int32_t first = 1);
+
+		inline void setRecycling(bool on) { recycling = on; if (!on) freed.clear(); }
+		inline bool isRecycling() const { return recycling; }
+		//Every id handed out or observed so far is below this, size an id indexed array with it
+		inline int32_t bound() const { return next; }
+		inline int32_t peek() const { return freed.empty() ? next : freed.back(); }
+	};
+}
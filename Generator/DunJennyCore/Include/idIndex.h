@@ -0,0 +1,42 @@
+/// \file idIndex.h
+/// \breif Flat open-addressing map from node id to node slot
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include "persistentArray.h"
+#include <cstdint>
+
+//header contents
+namespace graphSys {
+	class IdIndex {
+	private:
+		struct Entry {
+			int id;
+			uint32_t slot;
+		};
+
+		//Linear probing table, capacity is always a power of two
+		PersistentArray<Entry> table;
+		uint32_t count = 0;
+		uint32_t mask = 0;
+
+		inline uint32_t home(int id) const { return (uint32_t)((uint32_t)id * 2654435769u) & mask; }
+		void grow();
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+		static constexpr uint32_t empty = UINT32_MAX;
+
+		IdIndex();
+		~IdIndex();
+
+		uint32_t find(int id) const;
+		//Returns false if the id was already present
+		bool insert(int id, uint32_t slot);
+		void update(int id, uint32_t slot);
+		void erase(int id);
+		void clear();
+
+		inline uint32_t size() const { return count; }
+	};
+}
@@ -0,0 +1,19 @@
+/// \file layeredLayout.h
+/// \breif Sugiyama-style layered placement, ranks run left to right from the sources
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "layout.h"
+#include <vector>
+
+//header contents
+namespace graphSys {
+	//Layer index of every node slot by longest path from the sources, nodes nothing leads to.
+	//Edges that close a cycle are ignored so the ranking is defined on any graph
+	std::vector<uint32_t> longestPathRanks(const GraphStore& store);
+
+	//Ranks nodes, orders each layer by barycentric sweeps to cut crossings, then places
+	//layers edgeLength apart along x & the nodes of a layer edgeLength apart along y
+	void layeredLayout(Graph& G, const LayoutSettings& settings);
+}
@@ -0,0 +1,83 @@
+/// \file layout.h
+/// \breif Layout stage run on a derived graph, places every node for the editor & the distance targets
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "graph.h"
+#include "roomEmbedding.h"
+#include "threadPool.h"
+#include <memory>
+#include <string>
+
+//header contents
+namespace graphSys {
+	enum class LayoutMode {
+		//Keep the positions the derivation drew
+		None,
+		//Fruchterman-Reingold relaxation with Barnes-Hut repulsion, O(N log N) per iteration
+		Force,
+		//Sugiyama-style layers from the sources onwards, reads left to right & needs no iterations
+		Layered
+	};
+
+	struct LayoutSettings {
+		LayoutMode mode = LayoutMode::None;
+
+		uint32_t iterations = 100;
+		//Distance an edge settles at, every other spacing follows from it
+		double edgeLength = 100.0;
+		//Barnes-Hut opening angle, a cell this small relative to its distance counts as one body. 0 is exact
+		double theta = 1.0;
+		//Pull towards the centre that stops loose nodes drifting away
+		double gravity = 0.1;
+
+		//Place each rule's new nodes around the nodes they replace & relax only their neighbourhood,
+		//so the distance targets see laid out geometry at every derivation step
+		bool incremental = false;
+		//Nodes this many edges from a new node move too, the ring just past them holds still but still pushes
+		uint32_t localHops = 2;
+		uint32_t localIterations = 20;
+		//Caps the neighbourhood so a step around a hub stays cheap
+		uint32_t localMaxNodes = 256;
+
+		//Down & up barycentric passes the layered mode makes to cut edge crossings
+		uint32_t layeredSweeps = 4;
+
+		//Give each node a room by type & keep derived rooms apart. A new room that lands on another
+		//is moved to the nearest free spot, looking at up to nudgeTries spots
+		bool avoidOverlap = false;
+		uint32_t nudgeTries = 64;
+		FootprintTable footprints;
+
+		//Pack the footprints into a region after the layout, connected rooms kept close, & move each
+		//node to its room. 0 leaves a side of the region unbounded, rooms that do not fit are dropped
+		bool embed = false;
+		int embedWidth = 0;
+		int embedHeight = 0;
+		//Rooms packed together as one block before the blocks are packed into the region
+		uint32_t embedGroupSize = 8;
+
+		//0 uses every hardware thread, 1 runs on the calling thread
+		unsigned threads = 1;
+	};
+
+	const char* layoutModeName(LayoutMode mode);
+	//False when name is not none, force or layered
+	bool layoutModeFromName(const std::string& name, LayoutMode& mode);
+
+	class GraphLayout {
+	private:
+		std::unique_ptr<ThreadPool> pool;
+		RoomEmbedding rooms;
+	public:
+		GraphLayout();
+		~GraphLayout();
+
+		//Moves every node of G, the graph's extent follows so calcDistances reports the laid out size
+		void run(Graph& G, const LayoutSettings& settings);
+
+		//Rooms of the last run that embedded, empty otherwise
+		inline const RoomEmbedding& getRooms() const { return rooms; }
+	};
+}
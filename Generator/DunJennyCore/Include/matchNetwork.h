@@ -0,0 +1,42 @@
+/// \file matchNetwork.h
+/// \breif Live left hand side matches for every rule, kept up to date between derivation steps
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "compiledRule.h"
+
+//header contents
+namespace graphSys {
+	//Matches of one rule, re-matching uses the rule's rooted plans
+	struct RuleMatches {
+		CompiledRulePtr rule;
+		std::vector<Match> matches;
+	};
+
+	//Rete style network, entries run parallel to the caller's rule list. After each
+	//committed step only matches touching changed nodes are dropped & searched again.
+	class MatchNetwork {
+	private:
+		std::vector<RuleMatches> rules;
+
+		void matchAll(RuleMatches& entry, const GraphStore& store);
+		void matchAround(RuleMatches& entry, const GraphStore& store, const std::vector<uint32_t>& touched);
+	public:
+		MatchNetwork();
+		~MatchNetwork();
+
+		void build(const std::vector<CompiledRulePtr>& ruleList, const GraphStore& store);
+		void addRule(const CompiledRulePtr& rule, const GraphStore& store);
+		void removeRule(size_t i);
+		void moveToBack(size_t i);
+		void clear();
+
+		//Call with the store's transaction still open, before commit
+		void update(const GraphStore& store);
+
+		inline size_t size() const { return rules.size(); }
+		inline bool isLive(size_t i) const { return !rules[i].matches.empty(); }
+		inline const std::vector<Match>& matchesOf(size_t i) const { return rules[i].matches; }
+	};
+}
@@ -0,0 +1,76 @@
+/// \file matcher.h
+/// \breif Subgraph isomorphism search for the left hand side of a rule
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "rule.h"
+#include "graphStore.h"
+#include "randomGenerator.h"
+#include <functional>
+
+//header contents
+namespace graphSys {
+	//Graph slot matched to each pattern node, in pattern node order
+	typedef std::vector<uint32_t> Match;
+
+	//An edge the graph must contain between the current step and an earlier one
+	struct StepEdge {
+		uint32_t step;
+		bool fromStep;
+	};
+
+	//One pattern node of a search plan, steps are matched in plan order
+	struct SearchStep {
+		uint32_t patternNode;
+		TypeAtom type;
+
+		//Earlier step whose image supplies candidates through its incidence chain,
+		//npos draws candidates from the type index instead
+		uint32_t anchor;
+		bool anchorIsSource;
+
+		std::vector<StepEdge> checks;
+	};
+
+	//Pattern nodes ordered so that every step after the first of each connected
+	//component is adjacent to an already matched node
+	struct SearchPlan {
+		std::vector<SearchStep> steps;
+
+		//root forces which pattern node is matched first
+		static SearchPlan build(const Components& pattern, uint32_t root = GraphStore::npos);
+		inline uint32_t size() const { return (uint32_t)steps.size(); }
+		inline bool empty() const { return steps.empty(); }
+	};
+
+	//VF2 style backtracking, mappings are injective, keep node types and
+	//require every pattern edge to exist in the graph
+	class SubgraphMatcher {
+	private:
+		const SearchPlan& plan;
+		const GraphStore& store;
+		RandomGenerator* rg;
+		uint32_t rootSlot = GraphStore::npos;
+
+		std::vector<uint32_t> mapped;
+		std::vector<std::vector<uint32_t>> candidates;
+		std::function<bool(const Match&)> visit;
+		Match current;
+
+		bool extend(uint32_t depth);
+		bool accepts(uint32_t depth, uint32_t slot) const;
+		uint32_t rotation(uint32_t count);
+	public:
+		SubgraphMatcher(const SearchPlan& plan, const GraphStore& store, RandomGenerator* rg = nullptr);
+
+		//Calls visit for each match until it returns false, candidate order is
+		//rotated by a random offset at every level when a generator is supplied
+		void enumerate(std::function<bool(const Match&)> visit);
+		//Only matches that map the plan's first step onto slot
+		void enumerateFrom(uint32_t slot, std::function<bool(const Match&)> visit);
+
+		bool findFirst(Match& out);
+		std::vector<Match> findRandom(uint32_t k);
+	};
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <unordered_map>
+#include <time.h>
+#include <random>
+#include "typeRegistry.h"
+
+namespace graphSys {
+	class Node {
+	private:
+		//template <>
+		//auto meta::registerMembers<Node>();
+		int nodeID;
+		char nodeLabel;
+		TypeAtom nodeType;
+		int xPos, yPos;
+	public:
+		Node();
+		Node(int id, char label, TypeAtom type = types::Room);
+		~Node();
+		
+		inline int getID() const { return nodeID; }
+		inline void setID(int id) { nodeID = id; }
+
+		inline TypeAtom getType() const { return nodeType; }
+		inline void setType(TypeAtom type) { nodeType = type; }
+		inline const std::string& getTypeName() const { return TypeRegistry::name(nodeType); }
+
+		inline char getLabel() const { return nodeLabel; }
+		inline void setLabel(char l) { nodeLabel = l; }
+
+		inline int getXPos() const { return xPos; }
+		inline int getYPos() const { return yPos; }
+		inline void setXPos(int pos) { xPos = pos; }
+		inline void setYPos(int pos) { yPos = pos; }
+
+	};
+}
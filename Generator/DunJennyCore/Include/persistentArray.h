@@ -0,0 +1,106 @@
+/// \file persistentArray.h
+/// \breif Chunked copy-on-write array, copies share every chunk until written
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+//header contents
+namespace graphSys {
+	//Elements live in fixed size chunks held by a shared table. Copying the array
+	//only copies the table pointer, the first write after a copy clones the table
+	//and each chunk is cloned the first time it is written through that copy.
+	template<typename T, uint32_t ChunkBits = 6>
+	class PersistentArray {
+	private:
+		static constexpr uint32_t chunkSize = 1u << ChunkBits;
+		static constexpr uint32_t chunkMask = chunkSize - 1;
+
+		typedef std::vector<T> Chunk;
+		typedef std::vector<std::shared_ptr<Chunk>> Table;
+
+		std::shared_ptr<Table> table;
+		uint32_t count = 0;
+
+		inline Table& ownTable()
+		{
+			if (!table)
+				table = std::make_shared<Table>();
+			else if (table.use_count() > 1)
+				table = std::make_shared<Table>(*table);
+			return *table;
+		}
+
+		inline Chunk& ownChunk(uint32_t c)
+		{
+			std::shared_ptr<Chunk>& chunk = ownTable()[c];
+			if (chunk.use_count() > 1)
+			{
+				std::shared_ptr<Chunk> copy = std::make_shared<Chunk>();
+				copy->reserve(chunkSize);
+				copy->assign(chunk->begin(), chunk->end());
+				chunk = std::move(copy);
+			}
+			return *chunk;
+		}
+
+	public:
+		PersistentArray() {}
+		PersistentArray(uint32_t n, const T& fill) { assign(n, fill); }
+
+		inline uint32_t size() const { return count; }
+		inline bool empty() const { return count == 0; }
+
+		inline const T& operator[](uint32_t i) const { return (*(*table)[i >> ChunkBits])[i & chunkMask]; }
+		inline const T& back() const { return (*this)[count - 1]; }
+
+		inline void set(uint32_t i, const T& value) { ownChunk(i >> ChunkBits)[i & chunkMask] = value; }
+
+		void push_back(const T& value)
+		{
+			if ((count & chunkMask) == 0)
+			{
+				std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
+				chunk->reserve(chunkSize);
+				chunk->push_back(value);
+				ownTable().push_back(std::move(chunk));
+			}
+			else
+				ownChunk(count >> ChunkBits).push_back(value);
+			count++;
+		}
+
+		void pop_back()
+		{
+			count--;
+			if ((count & chunkMask) == 0)
+				ownTable().pop_back();
+			else
+				ownChunk(count >> ChunkBits).pop_back();
+		}
+
+		void assign(uint32_t n, const T& fill)
+		{
+			table = std::make_shared<Table>();
+			table->reserve((n + chunkMask) >> ChunkBits);
+			for (uint32_t i = 0; i < n; i += chunkSize)
+			{
+				uint32_t len = n - i < chunkSize ? n - i : chunkSize;
+				std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
+				chunk->reserve(chunkSize);
+				chunk->assign(len, fill);
+				table->push_back(std::move(chunk));
+			}
+			count = n;
+		}
+
+		void clear()
+		{
+			table.reset();
+			count = 0;
+		}
+	};
+}
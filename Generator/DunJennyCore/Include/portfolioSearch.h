@@ -0,0 +1,41 @@
+/// \file portfolioSearch.h
+/// \breif Races independent derivation chains and keeps the first one to meet the constraints
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "generationStrategy.h"
+#include "threadPool.h"
+#include <memory>
+
+//header contents
+namespace graphSys {
+	struct PortfolioResult {
+		bool success = false;
+		//Seed of the winning chain, a batch run of this seed alone derives the same graph
+		uint64_t seed = 0;
+		//Chains that started before the winner stopped the rest
+		uint32_t chainsStarted = 0;
+		long long genTimeMicros = 0;
+		Graph graph;
+		//Empty unless the search keeps history
+		std::vector<GraphSnapshot> history;
+	};
+
+	class PortfolioSearch {
+	private:
+		std::unique_ptr<ThreadPool> pool;
+		bool keepHistory = false;
+	public:
+		PortfolioSearch();
+		~PortfolioSearch();
+
+		//Keep every chain's derivation steps so the winner's can be replayed
+		inline void setKeepHistory(bool keep) { keepHistory = keep; }
+
+		//Runs chains with seeds firstSeed .. firstSeed + chains - 1 using the start graph's
+		//targets. Which chain wins depends on timing, the others stop at their next step
+		PortfolioResult run(const RuleFactory& rf, const Graph& startGraph, uint32_t chains, uint64_t firstSeed,
+			const SearchSettings& search = SearchSettings(), unsigned threads = 0, const LayoutSettings& layout = LayoutSettings());
+	};
+}
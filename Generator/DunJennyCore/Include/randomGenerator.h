@@ -0,0 +1,40 @@
+/// \file randomGenerator.h
+/// \breif Seedable pseudo random generator, xoshiro256** engine with a ziggurat gaussian
+/// \adapted from D. Blackman & S. Vigna (2018) 'Scrambled Linear Pseudorandom Number Generators'
+/// \adapted from G. Marsaglia & W. Tsang (2000) 'The Ziggurat Method for Generating Random Variables'
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+//header contents
+class RandomGenerator
+{
+private:
+	uint64_t state[4];
+
+public:
+	//Seeded once from std::random_device
+	RandomGenerator();
+	//Same seed, same sequence
+	explicit RandomGenerator(uint64_t seed);
+	~RandomGenerator();
+
+	void Seed(uint64_t seed);
+	uint64_t Next();
+
+	//Advance 2^128 steps, streams produced between jumps never overlap
+	void Jump();
+	//Returns a generator on the current stream and moves this one to the next
+	RandomGenerator Split();
+
+	//Inclusive of both bounds
+	int GenerateUniform(int min, int max);
+	int GenerateGaussian(int mean, int stdDev);
+	double GenerateUnit();
+	double GenerateNormal();
+};
@@ -0,0 +1,37 @@
+/// \file roomEmbedding.h
+/// \breif Packs every node's room footprint into a bounded region with the stb skyline packer
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "graph.h"
+#include <vector>
+
+//header contents
+namespace graphSys {
+	//Room rectangle by its top left corner, the level loader's view of a node
+	struct RoomPlacement {
+		int id;
+		TypeAtom type;
+		int x, y;
+		int width, height;
+	};
+
+	struct RoomEmbedding {
+		//Placed rooms in slot order, rooms that did not fit are left out
+		std::vector<RoomPlacement> rooms;
+		//Extent of the placed rooms from 0, 0
+		int width = 0;
+		int height = 0;
+		uint32_t unplaced = 0;
+	};
+
+	//Splits the graph into connected groups of up to groupSize rooms, packs each group into a
+	//near square block, then packs the blocks into the region in breadth first order from the
+	//start so connected groups land side by side. Rooms keep the table's spacing between them.
+	//A width or height of 0 leaves that side unbounded, an unbounded width packs near square
+	RoomEmbedding embedRooms(const GraphStore& store, const FootprintTable& footprints, int regionWidth, int regionHeight, uint32_t groupSize);
+
+	//Moves each placed room's node to the centre of its rectangle
+	void applyEmbedding(Graph& G, const RoomEmbedding& embedding);
+}
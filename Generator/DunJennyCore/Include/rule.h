@@ -0,0 +1,56 @@
+#pragma once
+#include "node.h"
+#include "edge.h"
+
+namespace graphSys {
+
+	struct Components {
+		std::vector<Node> nodes;
+		std::vector<Edge> edges;
+	};
+
+	struct Rule {
+	private:
+		std::string ruleID;
+		//left side
+		Components leftSide;
+		//right side 
+		Components rightSide;
+	public:
+		Rule();
+		Rule(Components left, Components right);
+		Rule(const Rule&) = default;
+		Rule(Rule&&) = default;
+		Rule& operator=(const Rule&) = default;
+		Rule& operator=(Rule&&) = default;
+		~Rule();
+
+		inline void setLeft(const Node& node) { this->leftSide.nodes.push_back(node); }
+		inline void setLefts(const std::vector<Node>& nodes) { this->leftSide.nodes.insert(this->leftSide.nodes.end(), nodes.begin(), nodes.end()); }
+		inline void setRight(const Node& node) { this->rightSide.nodes.push_back(node); }
+		inline void setRights(const std::vector<Node>& nodes) { this->rightSide.nodes.insert(this->rightSide.nodes.end(), nodes.begin(), nodes.end()); }
+
+		Node getRightNodeAtId(int id) const;
+
+		//inline void setComponents(Components comp) { this-> = comp.}
+		inline void addLeftEdge(const Edge& edge) { this->leftSide.edges.push_back(edge); }
+		inline void addLeftEdges(const std::vector<Edge>& edges) { this->leftSide.edges.insert(this->leftSide.edges.end(), edges.begin(), edges.end()); }
+		inline void addRightEdge(const Edge& edge) { this->rightSide.edges.push_back(edge); }
+		inline void addRightEdges(const std::vector<Edge>& edges) { this->rightSide.edges.insert(this->rightSide.edges.end(), edges.begin(), edges.end()); }
+
+		inline const Components& getLeft() const { return this->leftSide; }
+		inline const Components& getRight() const { return this->rightSide; }
+
+		inline const std::string& getID() const { return ruleID; }
+		inline void setID(std::string id) { ruleID = std::move(id); }
+
+		inline int getLeftSize() const { return this->leftSide.nodes.size(); }
+		inline int getRightSize() const { return this->rightSide.nodes.size(); }
+
+		inline int getLeftEdgeSize() const { return this->leftSide.edges.size(); }
+		inline int getRightEdgeSize() const { return this->rightSide.edges.size(); }
+
+		inline void updateRule(Components left, Components right) { leftSide = std::move(left); rightSide = std::move(right); }
+		inline void clear() { leftSide.nodes.clear(); leftSide.edges.clear(); rightSide.nodes.clear(); rightSide.edges.clear(); }
+	};
+}
\ No newline at end of file
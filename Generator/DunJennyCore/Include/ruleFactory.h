@@ -0,0 +1,44 @@
+#pragma once
+#include "graph.h"
+#include "compiledRule.h"
+
+namespace graphSys {
+	class RuleFactory {
+	private:
+		Components leftSide;
+		Components rightSide;
+		//Rule node ids, unique across every rule this factory builds
+		IdAllocator ruleIds;
+		std::vector<Rule> ruleList;
+		//Compiled alongside ruleList whenever a rule is added or changed
+		std::vector<CompiledRulePtr> compiledRules;
+		Rule nullRule;
+	public:
+		enum RuleSide {
+			LEFT = 0,
+			RIGHT = 1
+		};
+	public:
+		RuleFactory();
+		~RuleFactory();
+		void addNode(RuleSide s, TypeAtom type = types::Room);
+		void addEdge(RuleSide s, const Node& src, const Node& target);
+
+		inline const Components& getLeft() const { return leftSide; }
+		inline const Components& getRight() const { return rightSide; }
+		void addRule(Rule r);
+		void setRules(std::vector<Rule> newRules);
+		void updateRule(const Rule& ruleToUpdate, const Rule& newRule, int side);
+
+		const Rule& ruleAtId(const std::string& id) const;
+		void createRule(std::string ruleID);
+		void clearRules();
+		void printRule(const Rule& r);
+		void ruleBuilder();
+
+		inline const std::vector<Rule>& getRules() const { return ruleList; }
+		inline const std::vector<CompiledRulePtr>& getCompiledRules() const { return compiledRules; }
+
+		char ruleStr[512];
+	};
+}
\ No newline at end of file
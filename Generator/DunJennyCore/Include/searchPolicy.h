@@ -0,0 +1,47 @@
+/// \file searchPolicy.h
+/// \breif Selection & acceptance settings for deriveGraph, greedy, simulated annealing or beam search
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include "graph.h"
+#include "randomGenerator.h"
+#include <string>
+
+//header contents
+namespace graphSys {
+	enum class SearchMode {
+		//Keep any step that grows the graph, drop a rule for good when its step does not
+		Greedy,
+		//Keep a step by the Metropolis rule on targetEnergy, rules are never dropped
+		Annealing,
+		//Expand every kept graph & carry the lowest energy ones to the next round
+		Beam
+	};
+
+	struct SearchSettings {
+		SearchMode mode = SearchMode::Greedy;
+
+		//Temperature at the first step. It is multiplied by cooling after each kept step & by warming
+		//after each undone one, so a search that stalls on a hard target heats back up, but never
+		//past the temperature it started at
+		double initialTemperature = 0.05;
+		double cooling = 0.98;
+		double warming = 1.01;
+
+		//Graphs kept between rounds and steps tried from each of them per round, 0 counts as 1
+		uint32_t beamWidth = 4;
+		uint32_t beamExpansions = 4;
+	};
+
+	const char* searchModeName(SearchMode mode);
+	//False when name is not greedy, annealing or beam
+	bool searchModeFromName(const std::string& name, SearchMode& mode);
+
+	//How far G is outside its size & distance targets, each term relative to its upper target. 0 once all are met
+	double targetEnergy(Graph& G, std::pair<int, int> dist);
+	//Same windows as the energy, without the random stopping size the greedy search draws
+	bool meetsTargets(Graph& G, std::pair<int, int> dist);
+	//Metropolis rule, an increase in energy is kept with probability e^(-increase / temperature)
+	bool acceptAnnealing(double before, double after, double temperature, RandomGenerator& rng);
+}
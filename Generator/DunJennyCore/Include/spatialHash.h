@@ -0,0 +1,58 @@
+/// \file spatialHash.h
+/// \breif Uniform grid hashed by cell, finds the rooms near a point in O(1) expected time
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//header contents
+namespace graphSys {
+	//Axis aligned room centred on x, y
+	struct RoomRect {
+		int x, y;
+		int halfWidth, halfHeight;
+	};
+
+	//Rooms are filed under every cell they overlap. With cells at least as big as the largest
+	//room that is at most four cells each, so inserts, removals & queries touch a fixed number of cells
+	class SpatialHash {
+	private:
+		int cellSize;
+		std::unordered_map<uint64_t, std::vector<int>> cells;
+		std::unordered_map<int, RoomRect> rooms;
+
+		inline int cellOf(int v) const { return v >= 0 ? v / cellSize : -((-v + cellSize - 1) / cellSize); }
+		static inline uint64_t key(int cx, int cy) { return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy; }
+
+		template<typename Visit>
+		void forCells(const RoomRect& r, Visit visit) const
+		{
+			for (int cx = cellOf(r.x - r.halfWidth); cx <= cellOf(r.x + r.halfWidth); cx++)
+			{
+				for (int cy = cellOf(r.y - r.halfHeight); cy <= cellOf(r.y + r.halfHeight); cy++)
+					visit(key(cx, cy));
+			}
+		}
+	public:
+		explicit SpatialHash(int cellSize = 100);
+		~SpatialHash();
+
+		void insert(int id, const RoomRect& rect);
+		void remove(int id);
+		void clear();
+
+		//Ids of rooms within gap of rect, other than ignoreId
+		void query(const RoomRect& rect, int gap, int ignoreId, std::vector<int>& out) const;
+		bool overlaps(const RoomRect& rect, int gap, int ignoreId) const;
+		//Moves rect to the nearest free spot on square rings of step size around it, trying at most
+		//tries spots. False & rect untouched when none of them is free
+		bool findFree(RoomRect& rect, int gap, int ignoreId, uint32_t tries) const;
+
+		inline size_t size() const { return rooms.size(); }
+		inline int getCellSize() const { return cellSize; }
+	};
+}
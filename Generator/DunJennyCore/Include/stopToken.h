@@ -0,0 +1,31 @@
+/// \file stopToken.h
+/// \breif Cooperative cancellation flag shared between threads, stands in for C++20 std::stop_source
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <atomic>
+#include <memory>
+
+//header contents
+namespace graphSys {
+	class StopToken {
+	private:
+		std::shared_ptr<const std::atomic<bool>> state;
+	public:
+		//A default token never reports a stop
+		StopToken() = default;
+		explicit StopToken(std::shared_ptr<const std::atomic<bool>> s) : state(std::move(s)) {}
+
+		inline bool stopRequested() const { return state && state->load(std::memory_order_relaxed); }
+	};
+
+	class StopSource {
+	private:
+		std::shared_ptr<std::atomic<bool>> state = std::make_shared<std::atomic<bool>>(false);
+	public:
+		inline void requestStop() { state->store(true, std::memory_order_relaxed); }
+		inline bool stopRequested() const { return state->load(std::memory_order_relaxed); }
+		inline StopToken getToken() const { return StopToken(state); }
+	};
+}
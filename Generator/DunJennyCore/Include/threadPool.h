@@ -0,0 +1,47 @@
+/// \file threadPool.h
+/// \breif Fixed set of worker threads that share index ranges with the calling thread
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <cstdint>
+
+//header contents
+namespace graphSys {
+	class ThreadPool {
+	private:
+		std::vector<std::thread> workers;
+		std::mutex lock;
+		std::condition_variable wake;
+		std::condition_variable done;
+
+		//Current parallelFor, workers pick up a new one when generation changes
+		std::function<void()> task;
+		uint64_t generation = 0;
+		uint32_t busy = 0;
+		bool stopping = false;
+		std::exception_ptr failure;
+
+		void workerLoop();
+	public:
+		//0 uses one thread per hardware thread, the caller counts as one of them
+		explicit ThreadPool(unsigned threads = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		inline uint32_t size() const { return (uint32_t)workers.size() + 1; }
+
+		//Calls body(i) for every i in [0, count), returns once all calls are done.
+		//The first exception thrown by body is rethrown here.
+		void parallelFor(uint32_t count, const std::function<void(uint32_t)>& body);
+	};
+}
@@ -0,0 +1,40 @@
+/// \file typeRegistry.h
+/// \breif Interns node & edge type names into small integer atoms
+/// \author Kane White 
+/// \todo  
+#pragma once
+//includes
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+//header contents
+namespace graphSys {
+	typedef uint16_t TypeAtom;
+
+	//Built-in types, registered in this order before any user-defined type
+	namespace types {
+		const TypeAtom Room = 0;
+		const TypeAtom Start = 1;
+		const TypeAtom End = 2;
+		const TypeAtom Default = 3;
+	}
+
+	class TypeRegistry {
+	private:
+		std::mutex lock;
+		std::deque<std::string> names;
+		std::unordered_map<std::string, TypeAtom> atoms;
+
+		TypeRegistry();
+		static TypeRegistry& instance();
+	public:
+		//Returns the atom for a type name, registering it on first use
+		static TypeAtom intern(const std::string& name);
+		//Returns the name an atom was interned from
+		static const std::string& name(TypeAtom atom);
+		static size_t size();
+	};
+}
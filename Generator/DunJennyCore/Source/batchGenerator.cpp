@@ -0,0 +1,112 @@
+#include "batchGenerator.h"
+#include <chrono>
+
+namespace graphSys {
+
+	BatchGenerator::BatchGenerator()
+	{
+	}
+
+	BatchGenerator::~BatchGenerator()
+	{
+	}
+
+	BatchResult BatchGenerator::runJob(const RuleFactory& rf, const Graph& startGraph, const BatchSettings& settings, uint64_t seed) const
+	{
+		BatchResult result;
+		result.seed = seed;
+
+		//Split the derivation stream off first so drawing parameters never shifts it
+		RandomGenerator jobRng(seed);
+		RandomGenerator derivationRng = jobRng.Split();
+
+		auto draw = [&](const ParamRange& range) { return jobRng.GenerateUniform(range.min, range.max); };
+		BatchParams& params = result.params;
+		params.targetSizeMin = draw(settings.targetSizeMin);
+		params.targetSizeMax = std::max(params.targetSizeMin, draw(settings.targetSizeMax));
+		params.targetXDistMin = draw(settings.targetXDistMin);
+		params.targetXDistMax = std::max(params.targetXDistMin, draw(settings.targetXDistMax));
+		params.targetYDistMin = draw(settings.targetYDistMin);
+		params.targetYDistMax = std::max(params.targetYDistMin, draw(settings.targetYDistMax));
+		params.maxIterations = draw(settings.maxIterations);
+
+		//A plain copy would share chunks with the other jobs
+		Graph G = startGraph.deepCopy();
+
+		G.setTargetSizeMin(params.targetSizeMin);
+		G.setTargetSizeMax(params.targetSizeMax);
+		G.setTargetXDistMin(params.targetXDistMin);
+		G.setTargetXDistMax(params.targetXDistMax);
+		G.setTargetYDistMin(params.targetYDistMin);
+		G.setTargetYDistMax(params.targetYDistMax);
+		G.setMaxIter(params.maxIterations);
+
+		GenerationStrategy strat(rf, G, G.getIds(), derivationRng);
+		strat.setSearch(settings.search);
+		strat.setLayout(settings.layout);
+
+		auto preGenTime = std::chrono::steady_clock::now();
+		G = strat.deriveGraph(std::move(G));
+		auto postGenTime = std::chrono::steady_clock::now();
+
+		result.genTimeMicros = std::chrono::duration_cast<std::chrono::microseconds>(postGenTime - preGenTime).count();
+		result.success = G.getName() != "FAIL";
+
+		if (result.success && (settings.layout.mode != LayoutMode::None || settings.layout.embed))
+		{
+			//Jobs already fill the pool, nesting another would only oversubscribe it
+			LayoutSettings layout = settings.layout;
+			layout.threads = 1;
+			GraphLayout engine;
+			engine.run(G, layout);
+			if (settings.keepGraphs)
+				result.rooms = engine.getRooms();
+			result.layoutTimeMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - postGenTime).count();
+		}
+		result.iterations = G.iteration;
+		result.size = G.nodeCount();
+
+		//A failed derivation hands back an empty graph, report how far it got instead
+		if (!result.success)
+		{
+			result.iterations = params.maxIterations;
+			result.size = strat.getLastKeptSize() == 0 ? startGraph.nodeCount() : strat.getLastKeptSize();
+		}
+
+		if (settings.keepGraphs)
+		{
+			G.completed = result.success;
+			result.graph = G.snapshot();
+		}
+		return result;
+	}
+
+	void BatchGenerator::run(const RuleFactory& rf, const Graph& startGraph, const BatchSettings& settings)
+	{
+		if (settings.seedCount == 0 || startGraph.nodeCount() == 0)
+			return;
+
+		unsigned threads = settings.threads;
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		//Workers are kept between runs unless the thread count changes
+		if (!pool || pool->size() != threads)
+			pool.reset(new ThreadPool(threads));
+
+		//Each job writes only its own slot, so the store needs no locking
+		size_t first = results.size();
+		results.resize(first + settings.seedCount);
+		try
+		{
+			pool->parallelFor(settings.seedCount, [&](uint32_t i) {
+				results[first + i] = runJob(rf, startGraph, settings, settings.firstSeed + i);
+			});
+		}
+		catch (...)
+		{
+			results.resize(first);
+			throw;
+		}
+	}
+}
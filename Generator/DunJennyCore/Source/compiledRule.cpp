@@ -0,0 +1,54 @@
+#include "compiledRule.h"
+
+namespace graphSys {
+
+	CompiledRule::CompiledRule(const Rule& rule)
+		: source(rule), plan(SearchPlan::build(rule.getLeft()))
+	{
+		const Components& left = rule.getLeft();
+		for (uint32_t i = 0; i < left.nodes.size(); i++)
+			rootedPlans.push_back(SearchPlan::build(left, i));
+
+		//Resolve right edges to local indices once instead of per application
+		const Components& right = rule.getRight();
+		for (const Node& n : right.nodes)
+			rightNodes.push_back(TemplateNode{ n.getID(), n.getLabel(), n.getType() });
+
+		for (const Edge& e : right.edges)
+		{
+			uint32_t src = GraphStore::npos, trg = GraphStore::npos;
+			for (uint32_t i = 0; i < rightNodes.size(); i++)
+			{
+				if (src == GraphStore::npos && rightNodes[i].ruleId == e.getSrc().getID())
+					src = i;
+				if (trg == GraphStore::npos && rightNodes[i].ruleId == e.getTarget().getID())
+					trg = i;
+			}
+			if (src != GraphStore::npos && trg != GraphStore::npos)
+				rightEdges.push_back(TemplateEdge{ src, trg, e.getType() });
+		}
+	}
+
+	CompiledRule::~CompiledRule()
+	{
+	}
+
+	Components CompiledRule::instantiate(IdAllocator& ids, std::vector<std::pair<int, int>>* newIds) const
+	{
+		Components production;
+		production.nodes.reserve(rightNodes.size());
+		production.edges.reserve(rightEdges.size());
+
+		for (const TemplateNode& t : rightNodes)
+		{
+			int id = ids.allocate();
+			production.nodes.push_back(Node(id, t.label, t.type));
+			if (newIds != nullptr)
+				newIds->push_back(std::pair<int, int>(t.ruleId, id));
+		}
+
+		for (const TemplateEdge& t : rightEdges)
+			production.edges.push_back(Edge(production.nodes[t.src], production.nodes[t.trg], t.type));
+		return production;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#include "edge.h"
+
+namespace graphSys {
+
+	Edge::Edge()
+	{
+	}
+
+	Edge::Edge(Node srcNode, Node targetNode, TypeAtom edgeType)
+		: srcNode(srcNode), targetNode(targetNode), edgeType(edgeType)
+	{
+	}
+
+	Edge::~Edge()
+	{
+	}
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "extentTracker.h"
+
+namespace graphSys {
+
+	void ExtentTracker::add(int x, int y)
+	{
+		minX.push(x);
+		maxX.push(x);
+		minY.push(y);
+		maxY.push(y);
+	}
+
+	void ExtentTracker::remove(int x, int y)
+	{
+		minX.erase(x);
+		maxX.erase(x);
+		minY.erase(y);
+		maxY.erase(y);
+	}
+
+	void ExtentTracker::clear()
+	{
+		minX.clear();
+		maxX.clear();
+		minY.clear();
+		maxY.clear();
+	}
+
+	void ExtentTracker::assign(const std::vector<int>& xs, const std::vector<int>& ys)
+	{
+		minX.assign(xs);
+		maxX.assign(xs);
+		minY.assign(ys);
+		maxY.assign(ys);
+	}
+
+	Extent ExtentTracker::extent() const
+	{
+		Extent box;
+		if (empty())
+			return box;
+
+		box.minX = minX.top();
+		box.maxX = maxX.top();
+		box.minY = minY.top();
+		box.maxY = maxY.top();
+		return box;
+	}
+}
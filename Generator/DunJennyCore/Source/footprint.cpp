@@ -0,0 +1,39 @@
+#include "footprint.h"
+#include <algorithm>
+
+namespace graphSys {
+
+	FootprintTable::FootprintTable()
+	{
+		set(types::Room, Footprint{ 80, 80 });
+		set(types::Start, Footprint{ 60, 60 });
+		set(types::End, Footprint{ 60, 60 });
+	}
+
+	void FootprintTable::set(TypeAtom type, Footprint size)
+	{
+		if (type >= sizes.size())
+		{
+			sizes.resize(type + 1, fallback);
+			given.resize(type + 1, false);
+		}
+		sizes[type] = size;
+		given[type] = true;
+	}
+
+	Footprint FootprintTable::get(TypeAtom type) const
+	{
+		return type < sizes.size() && given[type] ? sizes[type] : fallback;
+	}
+
+	int FootprintTable::largest() const
+	{
+		int size = std::max(fallback.width, fallback.height);
+		for (TypeAtom t = 0; t < sizes.size(); t++)
+		{
+			if (given[t])
+				size = std::max(size, std::max(sizes[t].width, sizes[t].height));
+		}
+		return size + spacing;
+	}
+}
@@ -0,0 +1,367 @@
+#include "forceLayout.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace graphSys {
+
+	namespace {
+		//Below this bodies are summed exactly, deeper cells only cost memory
+		const uint32_t leafSize = 4;
+		const uint32_t maxDepth = 32;
+		//Keeps coincident nodes from dividing by zero
+		const double minDist2 = 0.01;
+	}
+
+	void BarnesHutTree::build(const std::vector<double>& x, const std::vector<double>& y)
+	{
+		xs = x.data();
+		ys = y.data();
+		cells.clear();
+		order.resize(x.size());
+		for (uint32_t i = 0; i < order.size(); i++)
+			order[i] = i;
+
+		if (order.empty())
+			return;
+
+		double minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+		for (uint32_t i = 1; i < x.size(); i++)
+		{
+			minX = std::min(minX, x[i]);
+			maxX = std::max(maxX, x[i]);
+			minY = std::min(minY, y[i]);
+			maxY = std::max(maxY, y[i]);
+		}
+
+		Cell root = {};
+		root.cx = (minX + maxX) / 2;
+		root.cy = (minY + maxY) / 2;
+		root.half = std::max(std::max(maxX - minX, maxY - minY) / 2, 1.0);
+		root.first = 0;
+		root.count = (uint32_t)order.size();
+		cells.push_back(root);
+		split(0, 0);
+	}
+
+	void BarnesHutTree::split(uint32_t cell, uint32_t depth)
+	{
+		//cells grows while recursing, so cells[cell] is only read through its index
+		uint32_t first = cells[cell].first, count = cells[cell].count;
+		double sumX = 0, sumY = 0;
+		for (uint32_t i = first; i < first + count; i++)
+		{
+			sumX += xs[order[i]];
+			sumY += ys[order[i]];
+		}
+		cells[cell].mass = count;
+		cells[cell].comX = sumX / count;
+		cells[cell].comY = sumY / count;
+		cells[cell].child = npos;
+
+		if (count <= leafSize || depth >= maxDepth)
+			return;
+
+		//Partition into west/east, then each half into south/north
+		double cx = cells[cell].cx, cy = cells[cell].cy, half = cells[cell].half / 2;
+		auto begin = order.begin() + first, end = begin + count;
+		auto east = std::partition(begin, end, [&](uint32_t b) { return xs[b] < cx; });
+		auto westNorth = std::partition(begin, east, [&](uint32_t b) { return ys[b] < cy; });
+		auto eastNorth = std::partition(east, end, [&](uint32_t b) { return ys[b] < cy; });
+
+		uint32_t bounds[5] = { first, (uint32_t)(westNorth - order.begin()), (uint32_t)(east - order.begin()),
+			(uint32_t)(eastNorth - order.begin()), first + count };
+		double offX[4] = { -half, -half, half, half };
+		double offY[4] = { -half, half, -half, half };
+
+		uint32_t child = (uint32_t)cells.size();
+		cells[cell].child = child;
+		for (uint32_t q = 0; q < 4; q++)
+		{
+			Cell c = {};
+			c.cx = cx + offX[q];
+			c.cy = cy + offY[q];
+			c.half = half;
+			c.first = bounds[q];
+			c.count = bounds[q + 1] - bounds[q];
+			c.child = npos;
+			cells.push_back(c);
+		}
+
+		for (uint32_t q = 0; q < 4; q++)
+		{
+			if (cells[child + q].count > 0)
+				split(child + q, depth + 1);
+		}
+	}
+
+	void BarnesHutTree::repulsion(uint32_t i, double theta, double k2, double& fx, double& fy) const
+	{
+		if (cells.empty())
+			return;
+
+		double x = xs[i], y = ys[i];
+		double theta2 = theta * theta;
+
+		uint32_t stack[4 * maxDepth + 4];
+		uint32_t top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const Cell& c = cells[stack[--top]];
+			if (c.count == 0)
+				continue;
+
+			if (c.child == npos)
+			{
+				for (uint32_t b = c.first; b < c.first + c.count; b++)
+				{
+					uint32_t j = order[b];
+					if (j == i)
+						continue;
+					double dx = x - xs[j], dy = y - ys[j];
+					double d2 = std::max(dx * dx + dy * dy, minDist2);
+					fx += dx * k2 / d2;
+					fy += dy * k2 / d2;
+				}
+				continue;
+			}
+
+			double dx = x - c.comX, dy = y - c.comY;
+			double d2 = dx * dx + dy * dy;
+			double size = 2 * c.half;
+			if (size * size < theta2 * d2)
+			{
+				d2 = std::max(d2, minDist2);
+				fx += dx * k2 * c.mass / d2;
+				fy += dy * k2 * c.mass / d2;
+			}
+			else
+			{
+				for (uint32_t q = 0; q < 4; q++)
+					stack[top++] = c.child + q;
+			}
+		}
+	}
+
+	void forceLayout(Graph& G, const LayoutSettings& settings, ThreadPool* pool)
+	{
+		const GraphStore& store = G.getStore();
+		uint32_t n = store.nodeCount();
+		if (n < 2 || settings.iterations == 0)
+			return;
+
+		std::vector<double> x(n), y(n), nextX(n), nextY(n);
+		double startX = 0, startY = 0;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			//Spread coincident nodes along a spiral so every pair has a direction to push along
+			double angle = i * 2.39996323;
+			x[i] = store.nodeXPos(i) + std::cos(angle) * 1e-3 * i;
+			y[i] = store.nodeYPos(i) + std::sin(angle) * 1e-3 * i;
+			startX += store.nodeXPos(i);
+			startY += store.nodeYPos(i);
+		}
+		startX /= n;
+		startY /= n;
+
+		double k = settings.edgeLength;
+		double k2 = k * k;
+		//Fruchterman-Reingold cooling, a move is capped at a temperature falling linearly to 0
+		double startTemp = std::max(k, k * std::sqrt((double)n) / 10);
+
+		//A few ranges per thread so uneven neighbourhoods still balance
+		uint32_t chunks = pool ? std::min(n, pool->size() * 4) : 1;
+		uint32_t chunkSize = (n + chunks - 1) / chunks;
+
+		BarnesHutTree tree;
+		for (uint32_t it = 0; it < settings.iterations; it++)
+		{
+			tree.build(x, y);
+			double temp = startTemp * (1.0 - (double)it / settings.iterations);
+
+			double cx = 0, cy = 0;
+			for (uint32_t i = 0; i < n; i++)
+			{
+				cx += x[i];
+				cy += y[i];
+			}
+			cx /= n;
+			cy /= n;
+
+			//Walking bodies in tree order keeps consecutive traversals on the same cells
+			const std::vector<uint32_t>& bodies = tree.bodies();
+			auto relax = [&](uint32_t chunk) {
+				uint32_t end = std::min(n, (chunk + 1) * chunkSize);
+				for (uint32_t b = chunk * chunkSize; b < end; b++)
+				{
+					uint32_t i = bodies[b];
+					double fx = 0, fy = 0;
+					tree.repulsion(i, settings.theta, k2, fx, fy);
+
+					//Edges pull with strength distance² / k, a self loop pulls nothing
+					for (uint32_t e = store.firstOutEdge(i); e != GraphStore::npos; e = store.nextOutEdge(e))
+					{
+						uint32_t j = store.edgeTarget(e);
+						double dx = x[j] - x[i], dy = y[j] - y[i];
+						double d = std::sqrt(dx * dx + dy * dy);
+						fx += dx * d / k;
+						fy += dy * d / k;
+					}
+					for (uint32_t e = store.firstInEdge(i); e != GraphStore::npos; e = store.nextInEdge(e))
+					{
+						uint32_t j = store.edgeSrc(e);
+						double dx = x[j] - x[i], dy = y[j] - y[i];
+						double d = std::sqrt(dx * dx + dy * dy);
+						fx += dx * d / k;
+						fy += dy * d / k;
+					}
+
+					fx -= (x[i] - cx) * settings.gravity;
+					fy -= (y[i] - cy) * settings.gravity;
+
+					double len = std::sqrt(fx * fx + fy * fy);
+					double step = len > 0 ? std::min(len, temp) / len : 0;
+					nextX[i] = x[i] + fx * step;
+					nextY[i] = y[i] + fy * step;
+				}
+			};
+
+			if (pool && chunks > 1)
+				pool->parallelFor(chunks, relax);
+			else
+				relax(0);
+
+			x.swap(nextX);
+			y.swap(nextY);
+		}
+
+		//Keep the graph centred where the derivation put it
+		double endX = 0, endY = 0;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			endX += x[i];
+			endY += y[i];
+		}
+		endX = startX - endX / n;
+		endY = startY - endY / n;
+
+		std::vector<int> finalX(n), finalY(n);
+		for (uint32_t i = 0; i < n; i++)
+		{
+			finalX[i] = (int)std::lround(x[i] + endX);
+			finalY[i] = (int)std::lround(y[i] + endY);
+		}
+		G.setNodePositions(finalX, finalY);
+	}
+
+	std::vector<uint32_t> localLayout(Graph& G, const std::vector<uint32_t>& seeds, const LayoutSettings& settings)
+	{
+		const GraphStore& store = G.getStore();
+		if (seeds.empty() || settings.localIterations == 0)
+			return std::vector<uint32_t>();
+
+		//Breadth first out from the seeds along edges in both directions. Nodes up to localHops
+		//away move, the next ring is fixed & only pushes or pulls on the moving ones
+		std::vector<uint32_t> nodes(seeds.begin(), seeds.end());
+		std::unordered_map<uint32_t, uint32_t> local;
+		for (uint32_t i = 0; i < nodes.size(); i++)
+			local.emplace(nodes[i], i);
+
+		uint32_t moving = (uint32_t)nodes.size();
+		size_t ringStart = 0;
+		for (uint32_t hop = 0; hop <= settings.localHops; hop++)
+		{
+			size_t ringEnd = nodes.size();
+			for (size_t r = ringStart; r < ringEnd; r++)
+			{
+				auto visit = [&](uint32_t next) {
+					if (local.size() < settings.localMaxNodes && local.emplace(next, (uint32_t)nodes.size()).second)
+						nodes.push_back(next);
+				};
+				for (uint32_t e = store.firstOutEdge(nodes[r]); e != GraphStore::npos; e = store.nextOutEdge(e))
+					visit(store.edgeTarget(e));
+				for (uint32_t e = store.firstInEdge(nodes[r]); e != GraphStore::npos; e = store.nextInEdge(e))
+					visit(store.edgeSrc(e));
+			}
+			ringStart = ringEnd;
+			if (hop < settings.localHops)
+				moving = (uint32_t)nodes.size();
+		}
+
+		uint32_t m = (uint32_t)nodes.size();
+		std::vector<double> x(m), y(m);
+		for (uint32_t i = 0; i < m; i++)
+		{
+			x[i] = store.nodeXPos(nodes[i]);
+			y[i] = store.nodeYPos(nodes[i]);
+		}
+
+		//Edges between involved nodes, as local indices
+		std::vector<std::pair<uint32_t, uint32_t>> links;
+		for (uint32_t i = 0; i < m; i++)
+		{
+			for (uint32_t e = store.firstOutEdge(nodes[i]); e != GraphStore::npos; e = store.nextOutEdge(e))
+			{
+				auto trg = local.find(store.edgeTarget(e));
+				if (trg != local.end() && trg->second != i)
+					links.push_back(std::pair<uint32_t, uint32_t>(i, trg->second));
+			}
+		}
+
+		double k = settings.edgeLength;
+		double k2 = k * k;
+		std::vector<double> fx(m), fy(m);
+		for (uint32_t it = 0; it < settings.localIterations; it++)
+		{
+			double temp = k * (1.0 - (double)it / settings.localIterations);
+			std::fill(fx.begin(), fx.end(), 0.0);
+			std::fill(fy.begin(), fy.end(), 0.0);
+
+			for (uint32_t i = 0; i < moving; i++)
+			{
+				for (uint32_t j = 0; j < m; j++)
+				{
+					if (j == i)
+						continue;
+					double dx = x[i] - x[j], dy = y[i] - y[j];
+					double d2 = dx * dx + dy * dy;
+					if (d2 < minDist2)
+					{
+						//Coincident nodes split along a direction fixed by their order
+						double angle = (i * m + j) * 2.39996323;
+						dx = std::cos(angle) * 0.1;
+						dy = std::sin(angle) * 0.1;
+						d2 = minDist2;
+					}
+					fx[i] += dx * k2 / d2;
+					fy[i] += dy * k2 / d2;
+				}
+			}
+
+			for (const std::pair<uint32_t, uint32_t>& link : links)
+			{
+				uint32_t a = link.first, b = link.second;
+				double dx = x[b] - x[a], dy = y[b] - y[a];
+				double d = std::sqrt(dx * dx + dy * dy);
+				fx[a] += dx * d / k;
+				fy[a] += dy * d / k;
+				fx[b] -= dx * d / k;
+				fy[b] -= dy * d / k;
+			}
+
+			for (uint32_t i = 0; i < moving; i++)
+			{
+				double len = std::sqrt(fx[i] * fx[i] + fy[i] * fy[i]);
+				double step = len > 0 ? std::min(len, temp) / len : 0;
+				x[i] += fx[i] * step;
+				y[i] += fy[i] * step;
+			}
+		}
+
+		for (uint32_t i = 0; i < moving; i++)
+			G.setNodePosition(nodes[i], (int)std::lround(x[i]), (int)std::lround(y[i]));
+		nodes.resize(moving);
+		return nodes;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,545 @@
+#include "generationStrategy.h"
+#include "forceLayout.h"
+#include <algorithm>
+#include <cmath>
+
+namespace graphSys {
+
+	GenerationStrategy::GenerationStrategy()
+	{
+	}
+
+	GenerationStrategy::GenerationStrategy(const RuleFactory& rf, const Graph& startGraph, const std::vector<std::pair<int, int>>& ids)
+		: RF(rf), rules(rf.getCompiledRules()), graph(startGraph), ids(ids)
+	{
+	}
+
+	GenerationStrategy::GenerationStrategy(const RuleFactory& rf, const Graph& startGraph, const std::vector<std::pair<int, int>>& ids, const RandomGenerator& rng)
+		: RF(rf), RG(rng), rules(rf.getCompiledRules()), graph(startGraph), ids(ids)
+	{
+	}
+
+	GenerationStrategy::~GenerationStrategy()
+	{
+	}
+
+	void GenerationStrategy::checkLeftNodes(const CompiledRule& rule, const Graph& graph)
+	{
+		const GraphStore& store = graph.getStore();
+
+		if (store.nodeCount() == 1)
+			initialNode = store.node(0);
+
+		//Pick one match at random among the injective, type & edge preserving mappings
+		SubgraphMatcher matcher(rule.getPlan(), store, &RG);
+		std::vector<Match> found = matcher.findRandom(1);
+
+		leftMatch.clear();
+		if (found.size() > 0)
+			useMatch(rule, found.front(), graph);
+	}
+
+	void GenerationStrategy::useMatch(const CompiledRule& rule, const Match& match, const Graph& graph)
+	{
+		const GraphStore& store = graph.getStore();
+		const std::vector<Node>& leftNodes = rule.getRule().getLeft().nodes;
+
+		leftMatch = match;
+		for (int i = 0; i < leftMatch.size(); i++)
+			matchingNodes.push_back(std::pair<int, int>(leftNodes.at(i).getID(), store.nodeId(leftMatch[i])));
+	}
+
+	void GenerationStrategy::checkLeftEdges(const Graph& graph)
+	{
+		//Left edges were already checked by the matcher, collect the matched nodes in rule order
+		graphSys::Components leftSideReplacement;
+		const GraphStore& store = graph.getStore();
+
+		for (int i = 0; i < leftMatch.size(); i++)
+		{
+			leftSideReplacement.nodes.push_back(store.node(leftMatch[i]));
+		}
+
+		leftSide = std::move(leftSideReplacement);
+	}
+
+	void GenerationStrategy::filterNodes(const CompiledRule& rule, const Graph& graph)
+	{
+		//filter node list based on present edges in left hand of rule
+		checkLeftNodes(rule, graph);
+		queueReplacement(rule, graph);
+	}
+
+	void GenerationStrategy::queueReplacement(const CompiledRule& rule, const Graph& graph)
+	{
+		checkLeftEdges(graph);
+
+		//Check each edge to see if its src and target nodes have been mapped to the left side rule
+		const graphSys::Components& rightSide = rule.getRule().getRight();
+		Rule newRule;
+
+		if (leftSide.nodes.size() > 0)
+		{
+			newRule.setLefts(leftSide.nodes);
+			newRule.setRights(rightSide.nodes);
+			newRule.addRightEdges(rightSide.edges);
+			potentialReplacements.push_back(std::move(newRule));
+		}
+	}
+
+	std::vector<std::pair<TypeAtom, TypeAtom>> GenerationStrategy::getGraphEdges()
+	{
+		graphEdgeMap.clear();
+		const GraphStore& store = graph.getStore();
+		for (uint32_t i = 0; i < store.edgeCount(); i++)
+		{
+			TypeAtom edgeSrc = store.nodeType(store.edgeSrc(i));
+			TypeAtom edgeTrg = store.nodeType(store.edgeTarget(i));
+			graphEdgeMap.push_back(std::pair<TypeAtom, TypeAtom>(edgeSrc, edgeTrg));
+		}
+		return graphEdgeMap;
+	}
+
+	Components GenerationStrategy::addProduction(const Components& rightSide)
+	{
+		Components newProduction;
+
+		for (int i = 0; i < rightSide.nodes.size(); i++)	//Add all nodes from rule right to new production
+		{
+			newProduction.nodes.push_back(rightSide.nodes[i]);
+		}
+
+		for (int i = 0; i < rightSide.edges.size(); i++)	//Add all edges from rule right to new production
+		{
+			newProduction.edges.push_back(rightSide.edges[i]);
+		}
+
+		return newProduction;
+	}
+
+
+	bool GenerationStrategy::applyRule(const CompiledRule& rule, Graph& graph)
+	{
+		filterNodes(rule, graph);
+		return rewrite(rule, graph);
+	}
+
+	bool GenerationStrategy::applyRule(const CompiledRule& rule, const Match& match, Graph& graph)
+	{
+		if (graph.nodeCount() == 1)
+			initialNode = graph.getStore().node(0);
+
+		useMatch(rule, match, graph);
+		queueReplacement(rule, graph);
+		return rewrite(rule, graph);
+	}
+
+	bool GenerationStrategy::rewrite(const CompiledRule& rule, Graph& graph)
+	{
+		if (potentialReplacements.size() == 0)
+			return false;
+
+		//Instantiate the right side template with ids from the graph's allocator, they never collide with a live node
+		std::vector<std::pair<int, int>> newIds;
+		Components production = rule.instantiate(graph.getNodeIds(), &newIds);
+
+		//Update id map held in graph so that s_Nodes & s_Edges can be generated correctly
+		graph.setIds(std::move(newIds));
+
+		graphSys::Rule replacement;
+		replacement.setID(rule.getID());
+		replacement.setLefts(leftSide.nodes);
+		replacement.setRights(production.nodes);
+		replacement.addRightEdges(production.edges);
+		graph.updateRule(std::move(replacement));
+		const Components& replaced = leftSide;
+		
+		//save temp oldSrc and temp oldTarget if they have
+		Node tempSrc, tempTarget, randNode;
+		std::vector<graphSys::Edge> srcConnections;
+		std::vector<graphSys::Edge> trgConnections;
+
+		//Get any sources and taraget edges currently connected to node for replacement
+		
+		const Node& firstNode = replaced.nodes.at(0);
+		if (graph.getConnectedEdges(firstNode).size() > 0)
+		{
+			if (graph.hasSource(firstNode))
+			{
+				std::vector<Edge> connections = graph.getConnectedEdges(firstNode);
+				Edge sEdge;
+				
+				for (int i = 0; i < connections.size(); i++)
+				{
+					if (connections.at(i).getSrc().getID() == firstNode.getID())
+						continue;
+					else
+						tempSrc = connections.at(i).getSrc();
+				}
+
+				sEdge.setSrc(tempSrc);
+				srcConnections.push_back(sEdge);
+			}
+		}
+
+		const Node& lastNode = replaced.nodes.back();
+		if (graph.getConnectedEdges(lastNode).size() > 0)
+		{
+			if (graph.hasTarget(lastNode))
+			{
+				std::vector<Edge> connections = graph.getConnectedEdges(lastNode);
+				Edge tEdge;
+
+				for (int i = 0; i < connections.size(); i++)
+				{
+					if (connections.at(i).getTarget().getID() == lastNode.getID())
+						continue;
+					else
+						tempTarget = connections.at(i).getTarget();
+				}
+
+				tEdge.setTarget(tempTarget);
+				trgConnections.push_back(tEdge);					
+			}
+		}
+
+		//remove dangling nodes, the store unlinks their edges with them
+		std::vector<graphSys::Node> danglingNodes(replaced.nodes.begin(), replaced.nodes.end());
+		if (danglingNodes.size() > 0)
+			graph.delNode(danglingNodes);
+
+		//set old src / targets to start and end of rule right
+		for (int i = 0; i < srcConnections.size(); i++)
+		{
+			srcConnections.at(i).setTarget(production.nodes.at(0));
+			production.edges.push_back(srcConnections.at(i));
+		}
+
+		for (int i = 0; i < trgConnections.size(); i++)
+		{
+			trgConnections.at(i).setSrc(production.nodes.back());
+			production.edges.push_back(trgConnections.at(i));
+		}
+
+		//add nodes to graph
+		if (layout.incremental)
+			placeProduction(production, replaced);
+		else
+		{
+			for (int i = 0; i < production.nodes.size(); i++)
+			{
+				production.nodes[i].setXPos(RG.GenerateGaussian(0, *graph.getTargetSizeMin() * 50));
+				production.nodes[i].setYPos(RG.GenerateGaussian(0, *graph.getTargetSizeMin() * 50));
+			}
+		}
+
+		for (int i = 0; i < production.nodes.size(); i++)
+		{
+			//Rooms already placed, including this production's earlier ones, are checked in the spatial hash
+			if (graph.isTrackingRooms())
+			{
+				int x = production.nodes[i].getXPos(), y = production.nodes[i].getYPos();
+				graph.findFreeSpot(production.nodes[i].getType(), x, y, layout.nudgeTries);
+				production.nodes[i].setXPos(x);
+				production.nodes[i].setYPos(y);
+			}
+			graph.addNode(production.nodes[i]);
+		}
+
+		//add edges to graph
+		for (int i = 0; i < production.edges.size(); i++)
+		{
+			graph.addEdge(production.edges[i]);
+		}
+
+		//Settle the new nodes among their neighbours, the rest of the graph stays put
+		if (layout.incremental)
+		{
+			std::vector<uint32_t> added;
+			for (const Node& n : production.nodes)
+				added.push_back(graph.getStore().findNode(n.getID()));
+			std::vector<uint32_t> moved = localLayout(graph, added, layout);
+
+			//Relaxation may push a room onto one outside the neighbourhood
+			if (graph.isTrackingRooms())
+			{
+				for (uint32_t slot : moved)
+					graph.nudgeNode(slot, layout.nudgeTries);
+			}
+		}
+
+		//Cleanup
+		matchingNodes.clear();
+		potentialReplacements.clear();
+		srcConnections.clear();
+		trgConnections.clear();
+		graph.iteration++;
+		return true;
+	}
+
+	void GenerationStrategy::placeProduction(Components& production, const Components& replaced)
+	{
+		//New nodes start on a small ring around where the replaced nodes were, turned by a random angle
+		double anchorX = 0, anchorY = 0;
+		for (const Node& n : replaced.nodes)
+		{
+			anchorX += n.getXPos();
+			anchorY += n.getYPos();
+		}
+		anchorX /= replaced.nodes.size();
+		anchorY /= replaced.nodes.size();
+
+		double radius = production.nodes.size() > 1 ? layout.edgeLength / 2 : 0;
+		double turn = RG.GenerateUniform(0, 359) * 3.14159265358979 / 180;
+		for (int i = 0; i < production.nodes.size(); i++)
+		{
+			double angle = turn + i * 2 * 3.14159265358979 / production.nodes.size();
+			production.nodes[i].setXPos((int)std::lround(anchorX + std::cos(angle) * radius));
+			production.nodes[i].setYPos((int)std::lround(anchorY + std::sin(angle) * radius));
+		}
+	}
+
+	GenerationStrategy::StepOutcome GenerationStrategy::greedyStep(Graph& G, int graphSize, std::pair<int, int> currentMaxDist)
+	{
+		int graphCopySize = G.nodeCount();
+
+		int targetSizeMin = *G.getTargetSizeMin();
+		int targetSizeMax = *G.getTargetSizeMax();
+
+		int targetXDistMax = *G.getTargetXDistMax();
+		int targetYDistMax = *G.getTargetYDistMax();
+
+		int targetXDistMin = *G.getTargetXDistMin();
+		int targetYDistMin = *G.getTargetYDistMin();
+
+		if (graphCopySize > targetSizeMin + RG.GenerateUniform(0, targetSizeMax - targetSizeMin) && graphCopySize < targetSizeMax &&
+			currentMaxDist.first < targetXDistMax && currentMaxDist.second < targetYDistMax && 
+			currentMaxDist.first > targetXDistMin && currentMaxDist.second > targetYDistMin)
+			return StepOutcome::Done;
+		else if (graphCopySize > graphSize)
+			return StepOutcome::Keep;
+		return StepOutcome::Drop;
+	}
+
+	GenerationStrategy::StepOutcome GenerationStrategy::annealingStep(Graph& G, std::pair<int, int> dist, double& energy, double temperature)
+	{
+		double after = targetEnergy(G, dist);
+		if (after == 0.0)
+			return StepOutcome::Done;
+
+		//A rejected step is undone but its rule stays in play, a later match may suit the targets
+		if (!acceptAnnealing(energy, after, temperature, RG))
+			return StepOutcome::Undo;
+
+		energy = after;
+		return StepOutcome::Keep;
+	}
+
+	Graph GenerationStrategy::deriveGraph(Graph G)
+	{
+		history.clear();
+		lastKeptSize = 0;
+		if (layout.avoidOverlap && !G.isTrackingRooms())
+			G.trackRooms(layout.footprints);
+
+		if (search.mode == SearchMode::Beam)
+			return deriveBeam(std::move(G));
+
+		//Get a copy of the production rules, dropping & requeueing them here leaves the strategy's own list
+		//whole for the next derivation
+		std::vector<CompiledRulePtr> rulesCpy = rules;
+
+		//Live matches for every rule, refreshed around each committed step
+		network.build(rulesCpy, G.getStore());
+
+		double energy = targetEnergy(G, G.calcDistances());
+		double temperature = search.initialTemperature;
+
+		int result = 0;
+		do
+		{
+			int graphSize = G.nodeCount();
+			int randN = -1;
+			CompiledRulePtr rule;
+			std::string ruleId;
+
+			//Only rules that currently match somewhere are worth drawing
+			std::vector<int> liveRules;
+			for (int i = 0; i < rulesCpy.size(); i++)
+			{
+				if (network.isLive(i))
+					liveRules.push_back(i);
+			}
+
+			if (liveRules.size() != 0)
+			{
+				randN = liveRules.at(RG.GenerateUniform(0, liveRules.size() - 1));
+				rule = rulesCpy.at(randN);
+				ruleId = rule->getID();
+			}
+			else
+				result = 1;
+
+			//Rewrite G in place, the step is kept or undone below
+			G.beginTransaction();
+			if (randN >= 0)
+			{
+				const std::vector<Match>& live = network.matchesOf(randN);
+				applyRule(*rule, live.at(RG.GenerateUniform(0, live.size() - 1)), G);
+			}
+
+			std::pair<int, int> currentMaxDist = G.calcDistances();
+			StepOutcome outcome = search.mode == SearchMode::Annealing ?
+				annealingStep(G, currentMaxDist, energy, temperature) : greedyStep(G, graphSize, currentMaxDist);
+
+			if (outcome == StepOutcome::Done || outcome == StepOutcome::Keep)
+			{
+				network.update(G.getStore());
+				G.commit();
+				G.addRuleApplied(ruleId);
+				lastKeptSize = G.nodeCount();
+				if (keepHistory)
+					history.push_back(G.snapshot());
+			}
+			else
+				G.rollback();
+			//Warming never goes past the starting temperature, past it every worse step would be kept
+			if (outcome == StepOutcome::Undo)
+				temperature = std::min(temperature * search.warming, search.initialTemperature);
+			else
+				temperature *= search.cooling;
+
+			if (outcome == StepOutcome::Done)
+				result = 1;
+			else if (outcome == StepOutcome::Keep && randN >= 0)
+			{
+				//Requeue the rule as written, its left edges still apply next time
+				rulesCpy.erase(rulesCpy.begin() + randN);
+				rulesCpy.push_back(rule);
+				network.moveToBack(randN);
+			}
+			else if (outcome == StepOutcome::Drop && randN >= 0)
+			{
+				rulesCpy.erase(rulesCpy.begin() + randN);
+				network.removeRule(randN);
+			}
+			G.iteration++;
+		} while (result == 0 && G.iteration < G.maxIterations && !stop.stopRequested());
+		
+		//A cancelled derivation leaves the loop without a result
+		if (result == 1 && G.iteration < G.maxIterations)
+		{
+			addStartAndEnd(G);
+			return G;
+		}
+		else
+		{
+			Fail.setName("FAIL");
+			return Fail;
+		}
+	}
+
+	Graph GenerationStrategy::deriveBeam(Graph G)
+	{
+		struct BeamEntry {
+			Graph graph;
+			double energy;
+			std::vector<GraphSnapshot> history;
+		};
+
+		std::vector<BeamEntry> beam;
+		beam.push_back(BeamEntry{ G, targetEnergy(G, G.calcDistances()), {} });
+
+		//A width or expansion count of 0 would leave a round with nothing to try, so each is at least 1
+		//& every round spends at least one step of maxIterations, the budget the other searches spend
+		const uint32_t beamWidth = std::max(1u, search.beamWidth);
+		const uint32_t beamExpansions = std::max(1u, search.beamExpansions);
+		int steps = G.iteration;
+		while (!rules.empty() && steps < G.maxIterations && !stop.stopRequested())
+		{
+			std::vector<BeamEntry> candidates;
+			for (const BeamEntry& parent : beam)
+			{
+				for (uint32_t i = 0; i < beamExpansions && steps < G.maxIterations; i++)
+				{
+					steps++;
+					const CompiledRule& rule = *rules.at(RG.GenerateUniform(0, rules.size() - 1));
+					SubgraphMatcher matcher(rule.getPlan(), parent.graph.getStore(), &RG);
+					std::vector<Match> found = matcher.findRandom(1);
+					if (found.empty())
+						continue;
+
+					//The store's columns are shared until written, but meta & the tracked rooms' spatial hash
+					//are copied whole, so with avoidOverlap on each child costs O(rooms) before its rewrite
+					BeamEntry child{ parent.graph, 0.0, parent.history };
+					if (!applyRule(rule, found.front(), child.graph))
+						continue;
+					child.graph.addRuleApplied(rule.getID());
+					child.energy = targetEnergy(child.graph, child.graph.calcDistances());
+					if (keepHistory)
+						child.history.push_back(child.graph.snapshot());
+
+					if (child.energy == 0.0)
+					{
+						G = std::move(child.graph);
+						G.iteration = steps;
+						history = std::move(child.history);
+						addStartAndEnd(G);
+						return G;
+					}
+					candidates.push_back(std::move(child));
+				}
+			}
+
+			//No rule drawn this round matched, try again from the same graphs
+			if (candidates.empty())
+				continue;
+
+			//Stable so equal energies keep the order they were drawn in & a seed stays reproducible
+			std::stable_sort(candidates.begin(), candidates.end(), [](const BeamEntry& a, const BeamEntry& b) { return a.energy < b.energy; });
+			if (candidates.size() > beamWidth)
+				candidates.erase(candidates.begin() + beamWidth, candidates.end());
+			beam = std::move(candidates);
+		}
+
+		Fail.setName("FAIL");
+		return Fail;
+	}
+
+	void GenerationStrategy::addStartAndEnd(Graph& G)
+	{
+		//Delete inital node from graph
+		std::vector<Node> node;
+		node.push_back(initialNode);
+		G.delNode(node);
+
+		//Add start and end nodes to graph
+		Node start(G.getNodeIds().allocate(), 's', types::Start);
+		Node end(G.getNodeIds().allocate(), 'e', types::End);
+		Node sTrg = G.nodes().front();
+		Node eSrc = G.nodes().back();
+		Edge sEdge, eEdge;
+
+		start.setXPos(sTrg.getXPos() - 200);
+		start.setYPos(sTrg.getYPos() - 200);
+
+		end.setXPos(eSrc.getXPos() - 200);
+		end.setYPos(eSrc.getYPos() - 200);
+
+		//sEdge.setSrc(start);
+		//sEdge.setTarget(sTrg);
+		eEdge.setSrc(eSrc);
+		eEdge.setTarget(end);
+
+		G.addNode(start);
+		G.addNode(end);
+		//Start & end sit at a fixed offset, move them off any room already there
+		if (G.isTrackingRooms())
+		{
+			G.nudgeNode(G.getStore().findNode(start.getID()), layout.nudgeTries);
+			G.nudgeNode(G.getStore().findNode(end.getID()), layout.nudgeTries);
+		}
+		G.addEdge(sEdge);
+		G.addEdge(eEdge);
+	}
+}
@@ -0,0 +1,408 @@
+#include "graph.h"
+#include <cstring>
+
+namespace graphSys {
+
+	Graph::Graph()
+	{
+		iteration = 0;
+	}
+
+	Graph::~Graph()
+	{}
+
+	void Graph::trackPlacement(int id, TypeAtom type, int x, int y, bool added)
+	{
+		if (added)
+			extent.add(x, y);
+		else
+			extent.remove(x, y);
+
+		if (trackingRooms)
+		{
+			if (added)
+				rooms.insert(id, roomRect(type, x, y));
+			else
+				rooms.remove(id);
+		}
+
+		if (store.inTransaction())
+			checkpoint.placements.push_back(PlacementChange{ added, id, type, x, y });
+	}
+
+	void Graph::addNode(const Node& n)
+	{
+		store.addNode(n);
+		nodeIds.observe(n.getID());
+		trackPlacement(n.getID(), n.getType(), n.getXPos(), n.getYPos(), true);
+	}
+	
+	void Graph::delNode(std::vector<Node>& nodeVec)
+	{
+		for (int i = 0; i < nodeVec.size(); i++)
+		{
+			uint32_t slot = store.findNode(nodeVec.at(i).getID());
+			if (slot != GraphStore::npos)
+			{
+				trackPlacement(store.nodeId(slot), store.nodeType(slot), store.nodeXPos(slot), store.nodeYPos(slot), false);
+				nodeIds.release(store.nodeId(slot));
+				store.removeNode(slot);
+			}
+		}
+	}
+
+	void Graph::delNode(std::vector<Node>& nodeVec, size_t pos)
+	{
+		if (nodeVec.size() > 0 && pos < store.nodeCount())
+		{
+			uint32_t slot = (uint32_t)pos;
+			trackPlacement(store.nodeId(slot), store.nodeType(slot), store.nodeXPos(slot), store.nodeYPos(slot), false);
+			nodeIds.release(store.nodeId((uint32_t)pos));
+			store.removeNode((uint32_t)pos);
+		}
+	}
+
+	void Graph::addEdge(const Edge& e)
+	{
+		//Edges may only join nodes held by this graph
+		uint32_t src = store.findNode(e.getSrc().getID());
+		uint32_t trg = store.findNode(e.getTarget().getID());
+
+		if (src != GraphStore::npos && trg != GraphStore::npos)
+			store.addEdge(src, trg, e.getType(), e.getAutoID());
+	}
+
+	void Graph::delEdge(std::vector<Edge>& edgeVec)
+	{
+		for (int i = 0; i < edgeVec.size(); i++)
+		{
+			uint32_t e = store.findEdge(edgeVec.at(i).getSrc().getID(), edgeVec.at(i).getTarget().getID());
+			if (e != GraphStore::npos)
+				store.removeEdge(e);
+		}
+	}
+
+	void Graph::setNodePosition(uint32_t slot, int x, int y)
+	{
+		int oldX = store.nodeXPos(slot), oldY = store.nodeYPos(slot);
+		if (oldX == x && oldY == y)
+			return;
+
+		trackPlacement(store.nodeId(slot), store.nodeType(slot), oldX, oldY, false);
+		store.setNodePosition(slot, x, y);
+		trackPlacement(store.nodeId(slot), store.nodeType(slot), x, y, true);
+	}
+
+	void Graph::setNodePositions(const std::vector<int>& xs, const std::vector<int>& ys)
+	{
+		//A transaction has to log each move, otherwise the extent is rebuilt once
+		if (store.inTransaction())
+		{
+			for (uint32_t i = 0; i < store.nodeCount(); i++)
+				setNodePosition(i, xs[i], ys[i]);
+			return;
+		}
+
+		for (uint32_t i = 0; i < store.nodeCount(); i++)
+			store.setNodePosition(i, xs[i], ys[i]);
+		extent.assign(xs, ys);
+		if (trackingRooms)
+			trackRooms(footprints);
+	}
+
+	void Graph::trackRooms(const FootprintTable& table)
+	{
+		trackingRooms = true;
+		footprints = table;
+		rooms = SpatialHash(table.largest());
+		for (uint32_t i = 0; i < store.nodeCount(); i++)
+			rooms.insert(store.nodeId(i), roomRect(store.nodeType(i), store.nodeXPos(i), store.nodeYPos(i)));
+	}
+
+	void Graph::stopTrackingRooms()
+	{
+		trackingRooms = false;
+		rooms.clear();
+	}
+
+	RoomRect Graph::roomRect(TypeAtom type, int x, int y) const
+	{
+		Footprint size = footprints.get(type);
+		return RoomRect{ x, y, size.width / 2, size.height / 2 };
+	}
+
+	bool Graph::findFreeSpot(TypeAtom type, int& x, int& y, uint32_t tries, int ignoreId) const
+	{
+		if (!trackingRooms)
+			return false;
+
+		RoomRect rect = roomRect(type, x, y);
+		if (!rooms.findFree(rect, footprints.getSpacing(), ignoreId, tries))
+			return false;
+		x = rect.x;
+		y = rect.y;
+		return true;
+	}
+
+	bool Graph::nudgeNode(uint32_t slot, uint32_t tries)
+	{
+		int x = store.nodeXPos(slot), y = store.nodeYPos(slot);
+		if (!findFreeSpot(store.nodeType(slot), x, y, tries, store.nodeId(slot)))
+			return false;
+		setNodePosition(slot, x, y);
+		return true;
+	}
+
+	std::vector<Node> Graph::getGraphNodes() const
+	{
+		std::vector<Node> nodes;
+		nodes.reserve(store.nodeCount());
+		for (uint32_t i = 0; i < store.nodeCount(); i++)
+			nodes.push_back(store.node(i));
+		return nodes;
+	}
+
+	std::vector<Edge> Graph::getGraphEdges() const
+	{
+		std::vector<Edge> edges;
+		edges.reserve(store.edgeCount());
+		for (uint32_t i = 0; i < store.edgeCount(); i++)
+			edges.push_back(store.edge(i));
+		return edges;
+	}
+
+	std::vector<Edge> Graph::getConnectedEdges(const Node& n) const
+	{
+		std::vector<Edge> connections;
+		uint32_t slot = store.findNode(n.getID());
+		if (slot == GraphStore::npos)
+			return connections;
+
+		for (uint32_t e = store.firstOutEdge(slot); e != GraphStore::npos; e = store.nextOutEdge(e))
+			connections.push_back(store.edge(e));
+
+		//Self loops are already on the outgoing chain
+		for (uint32_t e = store.firstInEdge(slot); e != GraphStore::npos; e = store.nextInEdge(e))
+		{
+			if (store.edgeSrc(e) != slot)
+				connections.push_back(store.edge(e));
+		}
+		return connections;
+	}
+
+	bool Graph::hasSource(const Node& n) const
+	{
+		uint32_t slot = store.findNode(n.getID());
+		return slot != GraphStore::npos && store.firstInEdge(slot) != GraphStore::npos;
+	}
+
+	bool Graph::hasTarget(const Node& n) const
+	{
+		uint32_t slot = store.findNode(n.getID());
+		return slot != GraphStore::npos && store.firstOutEdge(slot) != GraphStore::npos;
+	}
+
+	bool Graph::containsNode(const Node& n) const
+	{
+		return store.findNode(n.getID()) != GraphStore::npos;
+	}
+
+	Node Graph::nodeAtID(int id) const
+	{
+		uint32_t slot = store.findNode(id);
+		if (slot != GraphStore::npos)
+			return store.node(slot);
+		return nullNode;
+	}
+
+	Node Graph::nodeWithLabel(char label) const
+	{
+		for (uint32_t i = 0; i < store.nodeCount(); i++)
+		{
+			if (label == store.nodeLabel(i))
+			{
+				return store.node(i);
+			}
+		}
+		return nullNode;
+	}
+
+	bool Graph::matchEdge(Edge* one)
+	{
+		Edge empty;
+		empty.setType(TypeRegistry::intern("empty"));
+		//Check if both edges share the same source and target types
+		if (one->getSrc().getType() != empty.getSrc().getType())
+		{
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	Node Graph::randomMatch(const Node& n, RandomGenerator& rg) const
+	{
+		//Draw straight from the type bucket rather than retrying random slots
+		uint32_t count = store.typeCount(n.getType());
+		if (count == 0)
+			return nullNode;
+
+		return store.node(store.nodeOfType(n.getType(), rg.GenerateUniform(0, count - 1)));
+	}
+
+	void Graph::clearGraph()
+	{
+		store.clear();
+		extent.clear();
+		rooms.clear();
+		nodeIds.reset();
+	}
+
+	void Graph::beginTransaction()
+	{
+		checkpoint.iteration = iteration;
+		checkpoint.placements.clear();
+		checkpoint.ids = meta.ids;
+		checkpoint.nodeIds = nodeIds;
+		checkpoint.updatedRule = meta.updatedRule;
+		store.beginTransaction();
+	}
+
+	void Graph::commit()
+	{
+		store.commit();
+		checkpoint = GraphCheckpoint();
+	}
+
+	GraphSnapshot Graph::snapshot() const
+	{
+		GraphSnapshot snap;
+		snap.store = store;
+		snap.name = meta.name;
+		snap.iteration = iteration;
+		snap.completed = completed;
+		snap.rulesApplied = meta.rulesApplied.size();
+		return snap;
+	}
+
+	Graph Graph::deepCopy() const
+	{
+		Graph copy = *this;
+		copy.clearGraph();
+		for (const Node& n : nodes())
+			copy.addNode(n);
+		for (const Edge& e : edges())
+			copy.addEdge(e);
+		copy.nodeIds = nodeIds;
+		return copy;
+	}
+
+	void Graph::rollback()
+	{
+		store.rollback();
+		iteration = checkpoint.iteration;
+		//Undo placements newest first, the store is no longer recording so nothing is logged
+		for (auto it = checkpoint.placements.rbegin(); it != checkpoint.placements.rend(); ++it)
+		{
+			if (it->added)
+			{
+				extent.remove(it->x, it->y);
+				if (trackingRooms)
+					rooms.remove(it->id);
+			}
+			else
+			{
+				extent.add(it->x, it->y);
+				if (trackingRooms)
+					rooms.insert(it->id, roomRect(it->type, it->x, it->y));
+			}
+		}
+		meta.ids = std::move(checkpoint.ids);
+		nodeIds = std::move(checkpoint.nodeIds);
+		meta.updatedRule = std::move(checkpoint.updatedRule);
+		checkpoint = GraphCheckpoint();
+	}
+
+	std::vector<std::string> Graph::printGraphNodes(std::vector<std::pair<int, int>> ids)
+	{
+		//Print nodes
+		for (uint32_t i = 0; i < store.nodeCount(); i++)
+		{
+			int id = store.nodeId(i);
+			std::string idStr = std::to_string(id);
+
+			auto node = std::find_if(ids.begin(), ids.end(), [=](auto& ids) 
+			{ if(ids.first == id)
+				return ids.first == id; });
+
+			int nodeID = node->second;
+
+			meta.nodeList.push_back(std::to_string(nodeID));
+		}
+		return meta.nodeList;
+	}
+
+	std::vector<std::string> Graph::printGraph(std::vector<std::pair<int, int>> ids)
+	{
+		for (uint32_t i = 0; i < store.edgeCount(); i++)
+		{
+			int src = store.nodeId(store.edgeSrc(i));
+			int trg = store.nodeId(store.edgeTarget(i));
+			int* srcID;
+			int* trgID;
+			std::string srcStr;
+			std::string targetStr;
+			bool source = false;
+			bool target = false;
+
+			if (!store.edgeAutoID(i))
+			{
+				auto nodeSrc = std::find_if(ids.begin(), ids.end(), [&](auto& ids)
+				{
+					if (ids.first == src)
+						source = true;
+					return ids.first == src;
+				});
+				auto nodeTrg = std::find_if(ids.begin(), ids.end(), [&](auto& ids)
+				{
+					if (ids.first == trg)
+						target = true;
+					return ids.first == trg ;
+				});
+
+				if (source)
+				{
+					srcID = &nodeSrc->second;
+					srcStr = std::to_string(*srcID);
+				}
+				if (target)
+				{
+					trgID = &nodeTrg->second;
+					targetStr = std::to_string(*trgID);
+				}
+			}
+			
+			const char* srcChar = srcStr.c_str();
+			const char* trgChar = targetStr.c_str();
+
+			char buffer[256]; // <- danger, only storage for 256 characters.
+			strncpy(buffer, srcChar, sizeof(buffer));
+			strncat(buffer, "---", sizeof(buffer));
+			strncat(buffer, trgChar, sizeof(buffer));
+
+			std::string edge = (buffer);
+
+			if(source & target)
+				meta.edgeList.push_back(edge);
+		}
+		return meta.edgeList;
+	}
+
+	std::pair<int, int> Graph::calcDistances() const
+	{
+		Extent box = extent.extent();
+		return std::pair<int, int>(box.maxX, box.maxY);
+	}
+}
\ No newline at end of file
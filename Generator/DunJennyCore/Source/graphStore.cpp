@@ -0,0 +1,479 @@
+#include "graphStore.h"
+
+namespace graphSys {
+
+	GraphStore::GraphStore()
+	{
+	}
+
+	GraphStore::~GraphStore()
+	{
+	}
+
+	uint32_t GraphStore::addNode(const Node& n)
+	{
+		appendNodeSlot();
+
+		uint32_t slot = nodeCount() - 1;
+		nodes.ids.set(slot, n.getID());
+		nodes.types.set(slot, n.getType());
+		nodes.labels.set(slot, n.getLabel());
+		nodes.xPos.set(slot, n.getXPos());
+		nodes.yPos.set(slot, n.getYPos());
+		bucketInsert(slot, typeCount(n.getType()));
+
+		if (!index.insert(n.getID(), slot))
+			duplicateIds++;
+
+		if (recording)
+		{
+			UndoRecord rec = {};
+			rec.kind = UndoRecord::NodeAdded;
+			rec.slot = slot;
+			undoLog.push_back(rec);
+		}
+		return slot;
+	}
+
+	void GraphStore::appendNodeSlot()
+	{
+		nodes.ids.push_back(0);
+		nodes.types.push_back(types::Room);
+		nodes.labels.push_back(' ');
+		nodes.xPos.push_back(0);
+		nodes.yPos.push_back(0);
+		nodes.firstOut.push_back(npos);
+		nodes.firstIn.push_back(npos);
+		nodes.typePos.push_back(npos);
+	}
+
+	void GraphStore::bucketInsert(uint32_t slot, uint32_t pos)
+	{
+		TypeAtom type = nodes.types[slot];
+		if (type >= typeBuckets.size())
+			typeBuckets.resize(type + 1);
+
+		//Anything already at pos moves to the end of the bucket
+		PersistentArray<uint32_t>& bucket = typeBuckets[type];
+		if (pos < bucket.size())
+		{
+			uint32_t other = bucket[pos];
+			bucket.push_back(other);
+			nodes.typePos.set(other, bucket.size() - 1);
+			bucket.set(pos, slot);
+		}
+		else
+			bucket.push_back(slot);
+		nodes.typePos.set(slot, pos);
+	}
+
+	uint32_t GraphStore::bucketErase(uint32_t slot)
+	{
+		PersistentArray<uint32_t>& bucket = typeBuckets[nodes.types[slot]];
+		uint32_t pos = nodes.typePos[slot];
+		uint32_t moved = bucket.back();
+		bucket.set(pos, moved);
+		nodes.typePos.set(moved, pos);
+		bucket.pop_back();
+		return pos;
+	}
+
+	void GraphStore::removeNode(uint32_t slot)
+	{
+		if (slot >= nodeCount())
+			return;
+
+		int id = nodes.ids[slot];
+		bool indexed = index.find(id) == slot;
+
+		//Drop incident edges by walking the node's own chains
+		while (nodes.firstOut[slot] != npos)
+			removeEdge(nodes.firstOut[slot]);
+		while (nodes.firstIn[slot] != npos)
+			removeEdge(nodes.firstIn[slot]);
+
+		uint32_t typePos = bucketErase(slot);
+
+		if (recording)
+		{
+			UndoRecord rec = {};
+			rec.kind = UndoRecord::NodeRemoved;
+			rec.slot = slot;
+			rec.id = id;
+			rec.type = nodes.types[slot];
+			rec.label = nodes.labels[slot];
+			rec.xPos = nodes.xPos[slot];
+			rec.yPos = nodes.yPos[slot];
+			rec.indexed = indexed;
+			rec.typePos = typePos;
+			undoLog.push_back(rec);
+		}
+
+		//Swap the last node into the freed slot so removal stays O(degree)
+		uint32_t last = nodeCount() - 1;
+		if (slot != last)
+			moveNode(last, slot);
+
+		nodes.ids.pop_back();
+		nodes.types.pop_back();
+		nodes.labels.pop_back();
+		nodes.xPos.pop_back();
+		nodes.yPos.pop_back();
+		nodes.firstOut.pop_back();
+		nodes.firstIn.pop_back();
+		nodes.typePos.pop_back();
+
+		if (!indexed)
+		{
+			duplicateIds--;
+			return;
+		}
+
+		index.erase(id);
+		if (duplicateIds > 0)
+		{
+			//Promote a remaining node with the same id into the index
+			for (uint32_t i = 0; i < nodeCount(); i++)
+			{
+				if (nodes.ids[i] == id)
+				{
+					index.insert(id, i);
+					duplicateIds--;
+					break;
+				}
+			}
+		}
+	}
+
+	void GraphStore::moveNode(uint32_t from, uint32_t to)
+	{
+		nodes.ids.set(to, nodes.ids[from]);
+		nodes.types.set(to, nodes.types[from]);
+		nodes.labels.set(to, nodes.labels[from]);
+		nodes.xPos.set(to, nodes.xPos[from]);
+		nodes.yPos.set(to, nodes.yPos[from]);
+		nodes.firstOut.set(to, nodes.firstOut[from]);
+		nodes.firstIn.set(to, nodes.firstIn[from]);
+		nodes.typePos.set(to, nodes.typePos[from]);
+		typeBuckets[nodes.types[to]].set(nodes.typePos[to], to);
+
+		//Only the moved node's own edges refer to its slot
+		for (uint32_t e = nodes.firstOut[to]; e != npos; e = edges.nextOut[e])
+			edges.src.set(e, to);
+		for (uint32_t e = nodes.firstIn[to]; e != npos; e = edges.nextIn[e])
+			edges.trg.set(e, to);
+
+		if (index.find(nodes.ids[to]) == from)
+			index.update(nodes.ids[to], to);
+	}
+
+	uint32_t GraphStore::addEdge(uint32_t src, uint32_t trg, TypeAtom type, bool autoId)
+	{
+		appendEdgeSlot();
+
+		uint32_t e = edgeCount() - 1;
+		edges.src.set(e, src);
+		edges.trg.set(e, trg);
+		edges.types.set(e, type);
+		edges.autoId.set(e, autoId ? 1 : 0);
+		linkEdge(e);
+
+		if (recording)
+		{
+			UndoRecord rec = {};
+			rec.kind = UndoRecord::EdgeAdded;
+			rec.slot = e;
+			rec.src = src;
+			rec.trg = trg;
+			undoLog.push_back(rec);
+		}
+		return e;
+	}
+
+	void GraphStore::appendEdgeSlot()
+	{
+		edges.src.push_back(npos);
+		edges.trg.push_back(npos);
+		edges.types.push_back(types::Default);
+		edges.autoId.push_back(0);
+		edges.nextOut.push_back(npos);
+		edges.prevOut.push_back(npos);
+		edges.nextIn.push_back(npos);
+		edges.prevIn.push_back(npos);
+	}
+
+	void GraphStore::removeEdge(uint32_t e)
+	{
+		if (e >= edgeCount())
+			return;
+
+		if (recording)
+		{
+			UndoRecord rec = {};
+			rec.kind = UndoRecord::EdgeRemoved;
+			rec.slot = e;
+			rec.src = edges.src[e];
+			rec.trg = edges.trg[e];
+			rec.type = edges.types[e];
+			rec.autoId = edges.autoId[e];
+			rec.prevOut = edges.prevOut[e];
+			rec.nextOut = edges.nextOut[e];
+			rec.prevIn = edges.prevIn[e];
+			rec.nextIn = edges.nextIn[e];
+			undoLog.push_back(rec);
+		}
+
+		unlinkEdge(e);
+
+		//Swap the last edge into the freed slot so removal stays O(1)
+		uint32_t last = edgeCount() - 1;
+		if (e != last)
+			moveEdge(last, e);
+
+		edges.src.pop_back();
+		edges.trg.pop_back();
+		edges.types.pop_back();
+		edges.autoId.pop_back();
+		edges.nextOut.pop_back();
+		edges.prevOut.pop_back();
+		edges.nextIn.pop_back();
+		edges.prevIn.pop_back();
+	}
+
+	void GraphStore::linkEdge(uint32_t e)
+	{
+		uint32_t s = edges.src[e];
+		uint32_t t = edges.trg[e];
+
+		edges.prevOut.set(e, npos);
+		edges.nextOut.set(e, nodes.firstOut[s]);
+		if (nodes.firstOut[s] != npos)
+			edges.prevOut.set(nodes.firstOut[s], e);
+		nodes.firstOut.set(s, e);
+
+		edges.prevIn.set(e, npos);
+		edges.nextIn.set(e, nodes.firstIn[t]);
+		if (nodes.firstIn[t] != npos)
+			edges.prevIn.set(nodes.firstIn[t], e);
+		nodes.firstIn.set(t, e);
+	}
+
+	void GraphStore::unlinkEdge(uint32_t e)
+	{
+		if (edges.prevOut[e] != npos)
+			edges.nextOut.set(edges.prevOut[e], edges.nextOut[e]);
+		else
+			nodes.firstOut.set(edges.src[e], edges.nextOut[e]);
+		if (edges.nextOut[e] != npos)
+			edges.prevOut.set(edges.nextOut[e], edges.prevOut[e]);
+
+		if (edges.prevIn[e] != npos)
+			edges.nextIn.set(edges.prevIn[e], edges.nextIn[e]);
+		else
+			nodes.firstIn.set(edges.trg[e], edges.nextIn[e]);
+		if (edges.nextIn[e] != npos)
+			edges.prevIn.set(edges.nextIn[e], edges.prevIn[e]);
+	}
+
+	void GraphStore::moveEdge(uint32_t from, uint32_t to)
+	{
+		edges.src.set(to, edges.src[from]);
+		edges.trg.set(to, edges.trg[from]);
+		edges.types.set(to, edges.types[from]);
+		edges.autoId.set(to, edges.autoId[from]);
+		edges.nextOut.set(to, edges.nextOut[from]);
+		edges.prevOut.set(to, edges.prevOut[from]);
+		edges.nextIn.set(to, edges.nextIn[from]);
+		edges.prevIn.set(to, edges.prevIn[from]);
+
+		//Repoint the chain neighbours that still reference the old slot
+		if (edges.prevOut[to] != npos)
+			edges.nextOut.set(edges.prevOut[to], to);
+		else
+			nodes.firstOut.set(edges.src[to], to);
+		if (edges.nextOut[to] != npos)
+			edges.prevOut.set(edges.nextOut[to], to);
+
+		if (edges.prevIn[to] != npos)
+			edges.nextIn.set(edges.prevIn[to], to);
+		else
+			nodes.firstIn.set(edges.trg[to], to);
+		if (edges.nextIn[to] != npos)
+			edges.prevIn.set(edges.nextIn[to], to);
+	}
+
+	void GraphStore::setNodePosition(uint32_t slot, int x, int y)
+	{
+		if (recording)
+		{
+			UndoRecord rec = {};
+			rec.kind = UndoRecord::NodeMoved;
+			rec.slot = slot;
+			rec.xPos = nodes.xPos[slot];
+			rec.yPos = nodes.yPos[slot];
+			undoLog.push_back(rec);
+		}
+		nodes.xPos.set(slot, x);
+		nodes.yPos.set(slot, y);
+	}
+
+	void GraphStore::clear()
+	{
+		nodes = NodeColumns();
+		edges = EdgeColumns();
+		index.clear();
+		duplicateIds = 0;
+		typeBuckets.clear();
+		recording = false;
+		undoLog.clear();
+	}
+
+	void GraphStore::beginTransaction()
+	{
+		undoLog.clear();
+		baseNodeCount = nodeCount();
+		recording = true;
+	}
+
+	void GraphStore::commit()
+	{
+		undoLog.clear();
+		recording = false;
+	}
+
+	void GraphStore::rollback()
+	{
+		recording = false;
+
+		//Undoing in reverse order means every added element is the last in its
+		//columns again by the time it is popped
+		for (size_t i = undoLog.size(); i-- > 0;)
+		{
+			const UndoRecord& rec = undoLog[i];
+			switch (rec.kind)
+			{
+			case UndoRecord::NodeAdded:
+				removeNode(rec.slot);
+				break;
+			case UndoRecord::EdgeAdded:
+				removeEdge(rec.slot);
+				break;
+			case UndoRecord::NodeRemoved:
+				restoreNode(rec);
+				break;
+			case UndoRecord::EdgeRemoved:
+				restoreEdge(rec);
+				break;
+			case UndoRecord::NodeMoved:
+				nodes.xPos.set(rec.slot, rec.xPos);
+				nodes.yPos.set(rec.slot, rec.yPos);
+				break;
+			}
+		}
+		undoLog.clear();
+	}
+
+	void GraphStore::restoreNode(const UndoRecord& rec)
+	{
+		//Move the node that was swapped into the slot back out to the end
+		appendNodeSlot();
+		uint32_t last = nodeCount() - 1;
+		if (rec.slot != last)
+			moveNode(rec.slot, last);
+
+		nodes.ids.set(rec.slot, rec.id);
+		nodes.types.set(rec.slot, rec.type);
+		nodes.labels.set(rec.slot, rec.label);
+		nodes.xPos.set(rec.slot, rec.xPos);
+		nodes.yPos.set(rec.slot, rec.yPos);
+		nodes.firstOut.set(rec.slot, npos);
+		nodes.firstIn.set(rec.slot, npos);
+		bucketInsert(rec.slot, rec.typePos);
+
+		if (!index.insert(rec.id, rec.slot))
+		{
+			//A duplicate was promoted when this node went, hand the id back
+			duplicateIds++;
+			if (rec.indexed)
+				index.update(rec.id, rec.slot);
+		}
+	}
+
+	void GraphStore::restoreEdge(const UndoRecord& rec)
+	{
+		appendEdgeSlot();
+		uint32_t last = edgeCount() - 1;
+		if (rec.slot != last)
+			moveEdge(rec.slot, last);
+
+		uint32_t e = rec.slot;
+		edges.src.set(e, rec.src);
+		edges.trg.set(e, rec.trg);
+		edges.types.set(e, rec.type);
+		edges.autoId.set(e, rec.autoId);
+
+		//Relink at the exact chain positions the edge was removed from
+		edges.prevOut.set(e, rec.prevOut);
+		edges.nextOut.set(e, rec.nextOut);
+		if (rec.prevOut != npos)
+			edges.nextOut.set(rec.prevOut, e);
+		else
+			nodes.firstOut.set(rec.src, e);
+		if (rec.nextOut != npos)
+			edges.prevOut.set(rec.nextOut, e);
+
+		edges.prevIn.set(e, rec.prevIn);
+		edges.nextIn.set(e, rec.nextIn);
+		if (rec.prevIn != npos)
+			edges.nextIn.set(rec.prevIn, e);
+		else
+			nodes.firstIn.set(rec.trg, e);
+		if (rec.nextIn != npos)
+			edges.prevIn.set(rec.nextIn, e);
+	}
+
+	uint32_t GraphStore::findNode(int id) const
+	{
+		return index.find(id);
+	}
+
+	uint32_t GraphStore::findEdge(int srcId, int trgId) const
+	{
+		uint32_t src = findNode(srcId);
+		if (src == npos)
+			return npos;
+
+		for (uint32_t e = nodes.firstOut[src]; e != npos; e = edges.nextOut[e])
+		{
+			if (nodes.ids[edges.trg[e]] == trgId)
+				return e;
+		}
+		return npos;
+	}
+
+	bool GraphStore::hasEdge(uint32_t src, uint32_t trg) const
+	{
+		for (uint32_t e = nodes.firstOut[src]; e != npos; e = edges.nextOut[e])
+		{
+			if (edges.trg[e] == trg)
+				return true;
+		}
+		return false;
+	}
+
+	Node GraphStore::node(uint32_t slot) const
+	{
+		Node n(nodes.ids[slot], nodes.labels[slot], nodes.types[slot]);
+		n.setXPos(nodes.xPos[slot]);
+		n.setYPos(nodes.yPos[slot]);
+		return n;
+	}
+
+	Edge GraphStore::edge(uint32_t e) const
+	{
+		Edge ed(node(edges.src[e]), node(edges.trg[e]));
+		ed.setType(edges.types[e]);
+		ed.setAutoID(edges.autoId[e] != 0);
+		return ed;
+	}
+}
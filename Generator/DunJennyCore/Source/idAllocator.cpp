@@ -0,0 +1,46 @@
+#include "idAllocator.h"
+#include <stdexcept>
+
+namespace graphSys {
+
+	IdAllocator::IdAllocator(int32_t first)
+		: next(first)
+	{
+	}
+
+	IdAllocator::~IdAllocator()
+	{
+	}
+
+	int32_t IdAllocator::allocate()
+	{
+		if (!freed.empty())
+		{
+			int32_t id = freed.back();
+			freed.pop_back();
+			return id;
+		}
+
+		if (next == INT32_MAX)
+			throw std::overflow_error("Node ids exhausted!");
+		return next++;
+	}
+
+	void IdAllocator::release(int32_t id)
+	{
+		if (recycling && id < next)
+			freed.push_back(id);
+	}
+
+	void IdAllocator::observe(int32_t id)
+	{
+		if (id >= next)
+			next = id == INT32_MAX ? id : id + 1;
+	}
+
+	void IdAllocator::reset(int32_t first)
+	{
+		next = first;
+		freed.clear();
+	}
+}
@@ -0,0 +1,118 @@
+#include "idIndex.h"
+
+namespace graphSys {
+
+	IdIndex::IdIndex()
+	{
+	}
+
+	IdIndex::~IdIndex()
+	{
+	}
+
+	uint32_t IdIndex::find(int id) const
+	{
+		if (count == 0)
+			return npos;
+
+		for (uint32_t i = home(id);; i = (i + 1) & mask)
+		{
+			const Entry& entry = table[i];
+			if (entry.slot == empty)
+				return npos;
+			if (entry.id == id)
+				return entry.slot;
+		}
+	}
+
+	bool IdIndex::insert(int id, uint32_t slot)
+	{
+		//Keep the load factor at or below one half
+		if ((count + 1) * 2 > table.size())
+			grow();
+
+		for (uint32_t i = home(id);; i = (i + 1) & mask)
+		{
+			const Entry& entry = table[i];
+			if (entry.slot == empty)
+			{
+				table.set(i, Entry{ id, slot });
+				count++;
+				return true;
+			}
+			if (entry.id == id)
+				return false;
+		}
+	}
+
+	void IdIndex::update(int id, uint32_t slot)
+	{
+		if (count == 0)
+			return;
+
+		for (uint32_t i = home(id);; i = (i + 1) & mask)
+		{
+			const Entry& entry = table[i];
+			if (entry.slot == empty)
+				return;
+			if (entry.id == id)
+			{
+				table.set(i, Entry{ id, slot });
+				return;
+			}
+		}
+	}
+
+	void IdIndex::erase(int id)
+	{
+		if (count == 0)
+			return;
+
+		uint32_t i = home(id);
+		for (;; i = (i + 1) & mask)
+		{
+			if (table[i].slot == empty)
+				return;
+			if (table[i].id == id)
+				break;
+		}
+
+		//Backward shift deletion keeps probe chains intact without tombstones
+		uint32_t hole = i;
+		for (uint32_t j = (i + 1) & mask; table[j].slot != empty; j = (j + 1) & mask)
+		{
+			uint32_t want = home(table[j].id);
+			//Move the entry back if the hole lies on its probe path
+			if (((j - want) & mask) >= ((j - hole) & mask))
+			{
+				table.set(hole, table[j]);
+				hole = j;
+			}
+		}
+		table.set(hole, Entry{ 0, empty });
+		count--;
+	}
+
+	void IdIndex::clear()
+	{
+		table.clear();
+		count = 0;
+		mask = 0;
+	}
+
+	void IdIndex::grow()
+	{
+		PersistentArray<Entry> old = table;
+
+		uint32_t capacity = old.empty() ? 16 : old.size() * 2;
+		table.assign(capacity, Entry{ 0, empty });
+		mask = capacity - 1;
+		count = 0;
+
+		for (uint32_t i = 0; i < old.size(); i++)
+		{
+			if (old[i].slot != empty)
+				insert(old[i].id, old[i].slot);
+		}
+	}
+}
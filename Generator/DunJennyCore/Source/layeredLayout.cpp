@@ -0,0 +1,168 @@
+#include "layeredLayout.h"
+#include <algorithm>
+#include <cmath>
+
+namespace graphSys {
+
+	namespace {
+		//Depth first over out edges, marks edges that return to a node still on the stack
+		//& lists nodes in the order they finish, the reverse of a topological order
+		void depthFirst(const GraphStore& store, uint32_t root, std::vector<uint8_t>& state,
+			std::vector<uint8_t>& backEdge, std::vector<uint32_t>& finished)
+		{
+			std::vector<std::pair<uint32_t, uint32_t>> stack;
+			state[root] = 1;
+			stack.push_back(std::pair<uint32_t, uint32_t>(root, store.firstOutEdge(root)));
+			while (!stack.empty())
+			{
+				uint32_t node = stack.back().first;
+				uint32_t e = stack.back().second;
+				if (e == GraphStore::npos)
+				{
+					state[node] = 2;
+					finished.push_back(node);
+					stack.pop_back();
+					continue;
+				}
+
+				stack.back().second = store.nextOutEdge(e);
+				uint32_t next = store.edgeTarget(e);
+				if (state[next] == 1)
+					backEdge[e] = 1;
+				else if (state[next] == 0)
+				{
+					state[next] = 1;
+					stack.push_back(std::pair<uint32_t, uint32_t>(next, store.firstOutEdge(next)));
+				}
+			}
+		}
+	}
+
+	std::vector<uint32_t> longestPathRanks(const GraphStore& store)
+	{
+		uint32_t n = store.nodeCount();
+		std::vector<uint8_t> state(n, 0);
+		std::vector<uint8_t> backEdge(store.edgeCount(), 0);
+		std::vector<uint32_t> finished;
+		finished.reserve(n);
+
+		//Nodes nothing leads to, then whatever a cycle left unvisited. Derived start nodes have
+		//no edges of their own, so rooting a pass at them would reach nothing
+		for (uint32_t slot = 0; slot < n; slot++)
+		{
+			if (state[slot] == 0 && store.firstInEdge(slot) == GraphStore::npos)
+				depthFirst(store, slot, state, backEdge, finished);
+		}
+		for (uint32_t slot = 0; slot < n; slot++)
+		{
+			if (state[slot] == 0)
+				depthFirst(store, slot, state, backEdge, finished);
+		}
+
+		std::vector<uint32_t> rank(n, 0);
+		for (size_t i = finished.size(); i-- > 0;)
+		{
+			uint32_t node = finished[i];
+			for (uint32_t e = store.firstOutEdge(node); e != GraphStore::npos; e = store.nextOutEdge(e))
+			{
+				uint32_t next = store.edgeTarget(e);
+				if (!backEdge[e] && next != node)
+					rank[next] = std::max(rank[next], rank[node] + 1);
+			}
+		}
+		return rank;
+	}
+
+	void layeredLayout(Graph& G, const LayoutSettings& settings)
+	{
+		const GraphStore& store = G.getStore();
+		uint32_t n = store.nodeCount();
+		if (n == 0)
+			return;
+
+		std::vector<uint32_t> rank = longestPathRanks(store);
+		uint32_t layerCount = *std::max_element(rank.begin(), rank.end()) + 1;
+
+		std::vector<std::vector<uint32_t>> layers(layerCount);
+		for (uint32_t slot = 0; slot < n; slot++)
+			layers[rank[slot]].push_back(slot);
+
+		//Position of each node within its layer
+		std::vector<double> order(n);
+		for (const std::vector<uint32_t>& layer : layers)
+		{
+			for (uint32_t i = 0; i < layer.size(); i++)
+				order[layer[i]] = i;
+		}
+
+		//Sort each layer by the mean position of its neighbours on the side already fixed,
+		//downwards against predecessors then upwards against successors. Edges that skip
+		//layers count the neighbour where it sits rather than through dummy nodes
+		std::vector<std::pair<double, uint32_t>> keyed;
+		auto sweep = [&](uint32_t r, bool down) {
+			std::vector<uint32_t>& layer = layers[r];
+			keyed.clear();
+			for (uint32_t slot : layer)
+			{
+				double sum = 0;
+				uint32_t count = 0;
+				if (down)
+				{
+					for (uint32_t e = store.firstInEdge(slot); e != GraphStore::npos; e = store.nextInEdge(e))
+					{
+						uint32_t other = store.edgeSrc(e);
+						if (rank[other] < r)
+						{
+							sum += order[other];
+							count++;
+						}
+					}
+				}
+				else
+				{
+					for (uint32_t e = store.firstOutEdge(slot); e != GraphStore::npos; e = store.nextOutEdge(e))
+					{
+						uint32_t other = store.edgeTarget(e);
+						if (rank[other] > r)
+						{
+							sum += order[other];
+							count++;
+						}
+					}
+				}
+				//A node with nothing on that side keeps its place
+				keyed.push_back(std::pair<double, uint32_t>(count > 0 ? sum / count : order[slot], slot));
+			}
+
+			std::stable_sort(keyed.begin(), keyed.end(),
+				[](const std::pair<double, uint32_t>& a, const std::pair<double, uint32_t>& b) { return a.first < b.first; });
+			for (uint32_t i = 0; i < keyed.size(); i++)
+			{
+				layer[i] = keyed[i].second;
+				order[layer[i]] = i;
+			}
+		};
+
+		for (uint32_t s = 0; s < settings.layeredSweeps; s++)
+		{
+			for (uint32_t r = 1; r < layerCount; r++)
+				sweep(r, true);
+			for (uint32_t r = layerCount - 1; r-- > 0;)
+				sweep(r, false);
+		}
+
+		//Layers left to right, each centred on y = 0
+		std::vector<int> xs(n), ys(n);
+		for (uint32_t r = 0; r < layerCount; r++)
+		{
+			const std::vector<uint32_t>& layer = layers[r];
+			double centre = (layer.size() - 1) / 2.0;
+			for (uint32_t i = 0; i < layer.size(); i++)
+			{
+				xs[layer[i]] = (int)std::lround(r * settings.edgeLength);
+				ys[layer[i]] = (int)std::lround((i - centre) * settings.edgeLength);
+			}
+		}
+		G.setNodePositions(xs, ys);
+	}
+}
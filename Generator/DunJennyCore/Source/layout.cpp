@@ -0,0 +1,75 @@
+#include "layout.h"
+#include "forceLayout.h"
+#include "layeredLayout.h"
+#include <algorithm>
+
+namespace graphSys {
+
+	const char* layoutModeName(LayoutMode mode)
+	{
+		switch (mode)
+		{
+		case LayoutMode::Force:
+			return "force";
+		case LayoutMode::Layered:
+			return "layered";
+		default:
+			return "none";
+		}
+	}
+
+	bool layoutModeFromName(const std::string& name, LayoutMode& mode)
+	{
+		if (name == "none")
+			mode = LayoutMode::None;
+		else if (name == "force")
+			mode = LayoutMode::Force;
+		else if (name == "layered")
+			mode = LayoutMode::Layered;
+		else
+			return false;
+		return true;
+	}
+
+	GraphLayout::GraphLayout()
+	{
+	}
+
+	GraphLayout::~GraphLayout()
+	{
+	}
+
+	void GraphLayout::run(Graph& G, const LayoutSettings& settings)
+	{
+		rooms = RoomEmbedding();
+		if (settings.mode == LayoutMode::Layered)
+		{
+			//Linear in the graph apart from sorting each layer, threads would not pay for themselves
+			layeredLayout(G, settings);
+		}
+		else if (settings.mode == LayoutMode::Force)
+		{
+			unsigned threads = settings.threads;
+			if (threads == 0)
+				threads = std::max(1u, std::thread::hardware_concurrency());
+			if (threads > 1 && (!pool || pool->size() != threads))
+				pool.reset(new ThreadPool(threads));
+
+			forceLayout(G, settings, threads > 1 ? pool.get() : nullptr);
+		}
+
+		//Packed rooms cannot overlap, so the embedding replaces the nudge pass
+		if (settings.embed)
+		{
+			rooms = embedRooms(G.getStore(), settings.footprints, settings.embedWidth, settings.embedHeight, settings.embedGroupSize);
+			applyEmbedding(G, rooms);
+		}
+		//Layouts space nodes by edge length alone, settle any rooms they left on top of each other
+		else if (settings.mode != LayoutMode::None && settings.avoidOverlap)
+		{
+			G.trackRooms(settings.footprints);
+			for (uint32_t slot = 0; slot < G.nodeCount(); slot++)
+				G.nudgeNode(slot, settings.nudgeTries);
+		}
+	}
+}
@@ -0,0 +1,180 @@
+#include "matchNetwork.h"
+#include <unordered_map>
+
+namespace graphSys {
+
+	MatchNetwork::MatchNetwork()
+	{
+	}
+
+	MatchNetwork::~MatchNetwork()
+	{
+	}
+
+	void MatchNetwork::build(const std::vector<CompiledRulePtr>& ruleList, const GraphStore& store)
+	{
+		rules.clear();
+		for (const CompiledRulePtr& rule : ruleList)
+			addRule(rule, store);
+	}
+
+	void MatchNetwork::addRule(const CompiledRulePtr& rule, const GraphStore& store)
+	{
+		RuleMatches entry;
+		entry.rule = rule;
+		matchAll(entry, store);
+		rules.push_back(std::move(entry));
+	}
+
+	void MatchNetwork::removeRule(size_t i)
+	{
+		rules.erase(rules.begin() + i);
+	}
+
+	void MatchNetwork::moveToBack(size_t i)
+	{
+		RuleMatches entry = std::move(rules[i]);
+		rules.erase(rules.begin() + i);
+		rules.push_back(std::move(entry));
+	}
+
+	void MatchNetwork::clear()
+	{
+		rules.clear();
+	}
+
+	void MatchNetwork::matchAll(RuleMatches& entry, const GraphStore& store)
+	{
+		entry.matches.clear();
+		SubgraphMatcher matcher(entry.rule->getPlan(), store);
+		matcher.enumerate([&](const Match& m) {
+			entry.matches.push_back(m);
+			return true;
+		});
+	}
+
+	void MatchNetwork::matchAround(RuleMatches& entry, const GraphStore& store, const std::vector<uint32_t>& touched)
+	{
+		//A match is found once, from the first left node that landed on a touched slot
+		auto firstTouched = [&](const Match& m) {
+			for (uint32_t p = 0; p < m.size(); p++)
+			{
+				if (std::binary_search(touched.begin(), touched.end(), m[p]))
+					return p;
+			}
+			return GraphStore::npos;
+		};
+
+		const std::vector<SearchPlan>& rootedPlans = entry.rule->getRootedPlans();
+		for (uint32_t p = 0; p < rootedPlans.size(); p++)
+		{
+			TypeAtom type = rootedPlans[p].steps.front().type;
+			SubgraphMatcher matcher(rootedPlans[p], store);
+			for (uint32_t slot : touched)
+			{
+				if (store.nodeType(slot) != type)
+					continue;
+
+				matcher.enumerateFrom(slot, [&](const Match& m) {
+					if (firstTouched(m) == p)
+						entry.matches.push_back(m);
+					return true;
+				});
+			}
+		}
+	}
+
+	void MatchNetwork::update(const GraphStore& store)
+	{
+		const std::vector<UndoRecord>& log = store.changes();
+		if (log.empty())
+			return;
+
+		//Replay the log to learn where surviving nodes moved to and which slots changed.
+		//origin maps a current slot to its slot before the step, npos for new nodes.
+		std::unordered_map<uint32_t, uint32_t> origin;
+		std::unordered_map<uint32_t, uint32_t> moved;
+		std::vector<uint32_t> touched;
+		uint32_t count = store.nodeCountAtBegin();
+
+		auto originOf = [&](uint32_t slot) {
+			auto it = origin.find(slot);
+			return it == origin.end() ? slot : it->second;
+		};
+
+		for (const UndoRecord& rec : log)
+		{
+			switch (rec.kind)
+			{
+			case UndoRecord::NodeAdded:
+				origin[rec.slot] = GraphStore::npos;
+				touched.push_back(rec.slot);
+				count++;
+				break;
+			case UndoRecord::EdgeAdded:
+			case UndoRecord::EdgeRemoved:
+				touched.push_back(rec.src);
+				touched.push_back(rec.trg);
+				break;
+			case UndoRecord::NodeRemoved:
+			{
+				uint32_t last = count - 1;
+				uint32_t gone = originOf(rec.slot);
+				if (gone != GraphStore::npos)
+					moved[gone] = GraphStore::npos;
+				touched.erase(std::remove(touched.begin(), touched.end(), rec.slot), touched.end());
+
+				//Swap and pop moved the last node into the freed slot
+				if (last != rec.slot)
+				{
+					uint32_t from = originOf(last);
+					origin[rec.slot] = from;
+					if (from != GraphStore::npos)
+						moved[from] = rec.slot;
+					std::replace(touched.begin(), touched.end(), last, rec.slot);
+				}
+				origin.erase(last);
+				count--;
+				break;
+			}
+			case UndoRecord::NodeMoved:
+				//Positions play no part in matching
+				break;
+			}
+		}
+
+		std::sort(touched.begin(), touched.end());
+		touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+
+		for (RuleMatches& entry : rules)
+		{
+			//Renumber surviving matches and drop any that lost or touch a changed node
+			size_t kept = 0;
+			for (size_t i = 0; i < entry.matches.size(); i++)
+			{
+				Match& m = entry.matches[i];
+				bool alive = true;
+				for (uint32_t& slot : m)
+				{
+					auto it = moved.find(slot);
+					if (it != moved.end())
+						slot = it->second;
+					if (slot == GraphStore::npos || std::binary_search(touched.begin(), touched.end(), slot))
+					{
+						alive = false;
+						break;
+					}
+				}
+				if (alive)
+				{
+					if (kept != i)
+						entry.matches[kept] = std::move(m);
+					kept++;
+				}
+			}
+			entry.matches.resize(kept);
+
+			matchAround(entry, store, touched);
+		}
+	}
+}
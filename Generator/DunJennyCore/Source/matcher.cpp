@@ -0,0 +1,263 @@
+#include "matcher.h"
+
+namespace graphSys {
+
+	SearchPlan SearchPlan::build(const Components& pattern, uint32_t root)
+	{
+		SearchPlan plan;
+		uint32_t n = (uint32_t)pattern.nodes.size();
+
+		//Resolve pattern edges to node indices, edges to nodes outside the pattern are ignored
+		std::vector<std::pair<uint32_t, uint32_t>> links;
+		for (const Edge& edge : pattern.edges)
+		{
+			uint32_t src = GraphStore::npos, trg = GraphStore::npos;
+			for (uint32_t i = 0; i < n; i++)
+			{
+				if (pattern.nodes[i].getID() == edge.getSrc().getID() && src == GraphStore::npos)
+					src = i;
+				if (pattern.nodes[i].getID() == edge.getTarget().getID() && trg == GraphStore::npos)
+					trg = i;
+			}
+			if (src != GraphStore::npos && trg != GraphStore::npos)
+				links.push_back(std::pair<uint32_t, uint32_t>(src, trg));
+		}
+
+		std::vector<uint32_t> degree(n, 0);
+		for (const auto& link : links)
+		{
+			degree[link.first]++;
+			degree[link.second]++;
+		}
+
+		std::vector<uint32_t> stepOf(n, GraphStore::npos);
+		while (plan.steps.size() < n)
+		{
+			//Prefer the node with most edges into the matched set, then the highest degree
+			uint32_t best = GraphStore::npos;
+			uint32_t bestLinks = 0;
+			if (plan.steps.empty() && root < n)
+				best = root;
+			else
+			{
+				for (uint32_t i = 0; i < n; i++)
+				{
+					if (stepOf[i] != GraphStore::npos)
+						continue;
+
+					uint32_t toMatched = 0;
+					for (const auto& link : links)
+					{
+						if ((link.first == i && stepOf[link.second] != GraphStore::npos) ||
+							(link.second == i && stepOf[link.first] != GraphStore::npos))
+							toMatched++;
+					}
+
+					if (best == GraphStore::npos || toMatched > bestLinks ||
+						(toMatched == bestLinks && degree[i] > degree[best]))
+					{
+						best = i;
+						bestLinks = toMatched;
+					}
+				}
+			}
+
+			SearchStep step;
+			step.patternNode = best;
+			step.type = pattern.nodes[best].getType();
+			step.anchor = GraphStore::npos;
+			step.anchorIsSource = false;
+
+			uint32_t self = (uint32_t)plan.steps.size();
+			stepOf[best] = self;
+
+			for (const auto& link : links)
+			{
+				uint32_t other;
+				bool fromStep;
+				if (link.first == best && stepOf[link.second] != GraphStore::npos)
+				{
+					other = stepOf[link.second];
+					fromStep = true;
+				}
+				else if (link.second == best && stepOf[link.first] != GraphStore::npos)
+				{
+					other = stepOf[link.first];
+					fromStep = false;
+				}
+				else
+					continue;
+
+				//The first edge to an earlier step supplies candidates, the rest are checked
+				if (step.anchor == GraphStore::npos && other != self)
+				{
+					step.anchor = other;
+					step.anchorIsSource = !fromStep;
+				}
+				else
+					step.checks.push_back(StepEdge{ other, fromStep });
+			}
+
+			plan.steps.push_back(std::move(step));
+		}
+		return plan;
+	}
+
+	SubgraphMatcher::SubgraphMatcher(const SearchPlan& plan, const GraphStore& store, RandomGenerator* rg)
+		: plan(plan), store(store), rg(rg)
+	{
+	}
+
+	void SubgraphMatcher::enumerate(std::function<bool(const Match&)> visitMatch)
+	{
+		if (plan.empty() || store.nodeCount() < plan.size())
+			return;
+
+		visit = std::move(visitMatch);
+		mapped.assign(plan.size(), GraphStore::npos);
+		candidates.resize(plan.size());
+		current.assign(plan.size(), GraphStore::npos);
+		extend(0);
+	}
+
+	void SubgraphMatcher::enumerateFrom(uint32_t slot, std::function<bool(const Match&)> visitMatch)
+	{
+		rootSlot = slot;
+		enumerate(std::move(visitMatch));
+		rootSlot = GraphStore::npos;
+	}
+
+	bool SubgraphMatcher::findFirst(Match& out)
+	{
+		bool found = false;
+		enumerate([&](const Match& m) {
+			out = m;
+			found = true;
+			return false;
+		});
+		return found;
+	}
+
+	std::vector<Match> SubgraphMatcher::findRandom(uint32_t k)
+	{
+		std::vector<Match> found;
+		if (k == 0)
+			return found;
+
+		enumerate([&](const Match& m) {
+			found.push_back(m);
+			return found.size() < k;
+		});
+		return found;
+	}
+
+	uint32_t SubgraphMatcher::rotation(uint32_t count)
+	{
+		if (rg == nullptr || count < 2)
+			return 0;
+		return (uint32_t)rg->GenerateUniform(0, count - 1);
+	}
+
+	bool SubgraphMatcher::accepts(uint32_t depth, uint32_t slot) const
+	{
+		const SearchStep& step = plan.steps[depth];
+		if (store.nodeType(slot) != step.type)
+			return false;
+
+		//Injective, no graph node may stand in for two pattern nodes
+		for (uint32_t i = 0; i < depth; i++)
+		{
+			if (mapped[i] == slot)
+				return false;
+		}
+
+		for (const StepEdge& check : step.checks)
+		{
+			uint32_t other = check.step == depth ? slot : mapped[check.step];
+			bool present = check.fromStep ? store.hasEdge(slot, other) : store.hasEdge(other, slot);
+			if (!present)
+				return false;
+		}
+		return true;
+	}
+
+	bool SubgraphMatcher::extend(uint32_t depth)
+	{
+		if (depth == plan.size())
+		{
+			for (uint32_t i = 0; i < depth; i++)
+				current[plan.steps[i].patternNode] = mapped[i];
+			return visit(current);
+		}
+
+		const SearchStep& step = plan.steps[depth];
+		if (depth == 0 && rootSlot != GraphStore::npos)
+		{
+			if (rootSlot < store.nodeCount() && accepts(depth, rootSlot))
+			{
+				mapped[depth] = rootSlot;
+				if (!extend(depth + 1))
+					return false;
+			}
+			mapped[depth] = GraphStore::npos;
+			return true;
+		}
+
+		if (step.anchor == GraphStore::npos)
+		{
+			//Unanchored steps walk the bucket of nodes with the right type
+			uint32_t count = store.typeCount(step.type);
+			uint32_t offset = rotation(count);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint32_t slot = store.nodeOfType(step.type, (i + offset) % count);
+				if (!accepts(depth, slot))
+					continue;
+
+				mapped[depth] = slot;
+				if (!extend(depth + 1))
+					return false;
+			}
+			mapped[depth] = GraphStore::npos;
+			return true;
+		}
+
+		//Anchored steps only look at neighbours of the anchor's image
+		std::vector<uint32_t>& pool = candidates[depth];
+		pool.clear();
+		uint32_t anchor = mapped[step.anchor];
+		if (step.anchorIsSource)
+		{
+			for (uint32_t e = store.firstOutEdge(anchor); e != GraphStore::npos; e = store.nextOutEdge(e))
+			{
+				uint32_t slot = store.edgeTarget(e);
+				if (std::find(pool.begin(), pool.end(), slot) == pool.end())
+					pool.push_back(slot);
+			}
+		}
+		else
+		{
+			for (uint32_t e = store.firstInEdge(anchor); e != GraphStore::npos; e = store.nextInEdge(e))
+			{
+				uint32_t slot = store.edgeSrc(e);
+				if (std::find(pool.begin(), pool.end(), slot) == pool.end())
+					pool.push_back(slot);
+			}
+		}
+
+		uint32_t count = (uint32_t)pool.size();
+		uint32_t offset = rotation(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t slot = pool[(i + offset) % count];
+			if (!accepts(depth, slot))
+				continue;
+
+			mapped[depth] = slot;
+			if (!extend(depth + 1))
+				return false;
+		}
+		mapped[depth] = GraphStore::npos;
+		return true;
+	}
+}
@@ -0,0 +1,17 @@
+#include "node.h"
+
+namespace graphSys {
+	//Default constructor, the node has no id so edges to it never resolve
+	Node::Node()
+		: nodeID(-1), nodeLabel(' '), nodeType(types::Room), xPos(0), yPos(0)
+	{}
+
+	Node::Node(int id, char label, TypeAtom type)
+		: nodeID(id), nodeLabel(label), nodeType(type), xPos(0), yPos(0)
+	{
+	}
+
+	Node::~Node()
+	{
+	}
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "portfolioSearch.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace graphSys {
+
+	PortfolioSearch::PortfolioSearch()
+	{
+	}
+
+	PortfolioSearch::~PortfolioSearch()
+	{
+	}
+
+	PortfolioResult PortfolioSearch::run(const RuleFactory& rf, const Graph& startGraph, uint32_t chains, uint64_t firstSeed,
+		const SearchSettings& search, unsigned threads, const LayoutSettings& layout)
+	{
+		PortfolioResult result;
+		result.graph.setName("FAIL");
+		if (chains == 0 || startGraph.nodeCount() == 0)
+			return result;
+
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		if (!pool || pool->size() != threads)
+			pool.reset(new ThreadPool(threads));
+
+		StopSource stop;
+		std::mutex lock;
+		std::atomic<uint32_t> started(0);
+
+		auto preGenTime = std::chrono::steady_clock::now();
+		pool->parallelFor(chains, [&](uint32_t i) {
+			//Chains still queued when a winner is found never start
+			if (stop.stopRequested())
+				return;
+			started++;
+
+			//A plain copy would share chunks with the other chains
+			Graph G = startGraph.deepCopy();
+
+			//Same stream BatchGenerator gives this seed's derivation
+			GenerationStrategy strat(rf, G, G.getIds(), RandomGenerator(firstSeed + i));
+			strat.setStopToken(stop.getToken());
+			strat.setSearch(search);
+			strat.setLayout(layout);
+			strat.setKeepHistory(keepHistory);
+			G = strat.deriveGraph(std::move(G));
+			if (G.getName() == "FAIL")
+				return;
+
+			std::lock_guard<std::mutex> guard(lock);
+			if (result.success)
+				return;
+
+			stop.requestStop();
+			result.success = true;
+			result.seed = firstSeed + i;
+			result.genTimeMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - preGenTime).count();
+			result.graph = std::move(G);
+			result.history = strat.getHistory();
+		});
+
+		result.chainsStarted = started;
+		if (!result.success)
+			result.genTimeMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - preGenTime).count();
+		return result;
+	}
+}
@@ -0,0 +1,189 @@
+#include "randomGenerator.h"
+#include <stdexcept>
+#include <cmath>
+
+namespace {
+	inline uint64_t rotl(uint64_t x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	//Used to expand a single seed into the four words of engine state
+	inline uint64_t splitMix64(uint64_t& x)
+	{
+		uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	//128 layer ziggurat for the standard normal, built once on first use
+	struct ZigguratTables {
+		uint32_t kn[128];
+		double wn[128];
+		double fn[128];
+
+		ZigguratTables()
+		{
+			const double m1 = 2147483648.0;
+			const double vn = 9.91256303526217e-3;
+			double dn = 3.442619855899, tn = dn;
+			double q = vn / std::exp(-0.5 * dn * dn);
+
+			kn[0] = (uint32_t)((dn / q) * m1);
+			kn[1] = 0;
+			wn[0] = q / m1;
+			wn[127] = dn / m1;
+			fn[0] = 1.0;
+			fn[127] = std::exp(-0.5 * dn * dn);
+
+			for (int i = 126; i >= 1; i--)
+			{
+				dn = std::sqrt(-2.0 * std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+				kn[i + 1] = (uint32_t)((dn / tn) * m1);
+				tn = dn;
+				fn[i] = std::exp(-0.5 * dn * dn);
+				wn[i] = dn / m1;
+			}
+		}
+	};
+
+	const ZigguratTables& ziggurat()
+	{
+		static const ZigguratTables tables;
+		return tables;
+	}
+}
+
+RandomGenerator::RandomGenerator()
+{
+	std::random_device rd;
+	Seed(((uint64_t)rd() << 32) ^ rd());
+}
+
+RandomGenerator::RandomGenerator(uint64_t seed)
+{
+	Seed(seed);
+}
+
+RandomGenerator::~RandomGenerator()
+{}
+
+void RandomGenerator::Seed(uint64_t seed)
+{
+	for (int i = 0; i < 4; i++)
+		state[i] = splitMix64(seed);
+}
+
+uint64_t RandomGenerator::Next()
+{
+	const uint64_t result = rotl(state[1] * 5, 7) * 9;
+	const uint64_t t = state[1] << 17;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = rotl(state[3], 45);
+
+	return result;
+}
+
+void RandomGenerator::Jump()
+{
+	static const uint64_t jump[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+	uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int b = 0; b < 64; b++)
+		{
+			if (jump[i] & (1ull << b))
+			{
+				s0 ^= state[0];
+				s1 ^= state[1];
+				s2 ^= state[2];
+				s3 ^= state[3];
+			}
+			Next();
+		}
+	}
+	state[0] = s0;
+	state[1] = s1;
+	state[2] = s2;
+	state[3] = s3;
+}
+
+RandomGenerator RandomGenerator::Split()
+{
+	RandomGenerator child = *this;
+	Jump();
+	return child;
+}
+
+int RandomGenerator::GenerateUniform(int min, int max)
+{
+	//validate input
+	if (min > max)
+		throw std::invalid_argument("Invalid generation range!");
+
+	//Reject the top sliver of the range so every value is equally likely
+	uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+	uint64_t threshold = (0 - range) % range;
+	uint64_t r;
+	do
+	{
+		r = Next();
+	} while (r < threshold);
+
+	return (int)((int64_t)min + (int64_t)(r % range));
+}
+
+int RandomGenerator::GenerateGaussian(int mean, int stdDev)
+{
+	//validate input
+	if (stdDev < 0)
+		throw std::invalid_argument("Invalid generation range!");
+
+	return (int)(mean + stdDev * GenerateNormal());
+}
+
+double RandomGenerator::GenerateUnit()
+{
+	//53 random bits, offset by half a step so the result is never 0 or 1
+	return ((double)(Next() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+double RandomGenerator::GenerateNormal()
+{
+	const ZigguratTables& z = ziggurat();
+	const double r = 3.442620;
+
+	for (;;)
+	{
+		int32_t hz = (int32_t)(uint32_t)(Next() >> 32);
+		uint32_t iz = hz & 127;
+		uint32_t magnitude = hz < 0 ? 0u - (uint32_t)hz : (uint32_t)hz;
+		double x = hz * z.wn[iz];
+
+		//Fast path, the point lies inside the rectangle of its layer
+		if (magnitude < z.kn[iz])
+			return x;
+
+		if (iz == 0)
+		{
+			//Sample from the tail beyond r
+			double y;
+			do
+			{
+				x = -std::log(GenerateUnit()) / r;
+				y = -std::log(GenerateUnit());
+			} while (y + y < x * x);
+			return hz > 0 ? r + x : -r - x;
+		}
+
+		if (z.fn[iz] + GenerateUnit() * (z.fn[iz - 1] - z.fn[iz]) < std::exp(-0.5 * x * x))
+			return x;
+	}
+}
@@ -0,0 +1,229 @@
+#include "roomEmbedding.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+//Private copy of the packer. Large rects lift the 65535 limit on the region, which graphs of thousands
+//of rooms pass, but change the packer's structs. ImGui compiles them without it in imgui_draw.cpp,
+//so every name with linkage is renamed here & the editor, which links both, sees two distinct packers
+#define stbrp_context dj_stbrp_context
+#define stbrp_node dj_stbrp_node
+#define stbrp_rect dj_stbrp_rect
+#define stbrp_coord dj_stbrp_coord
+#define stbrp__findresult dj_stbrp__findresult
+#define stbrp_init_target dj_stbrp_init_target
+#define stbrp_pack_rects dj_stbrp_pack_rects
+#define stbrp_setup_allow_out_of_mem dj_stbrp_setup_allow_out_of_mem
+#define stbrp_setup_heuristic dj_stbrp_setup_heuristic
+#define STBRP_LARGE_RECTS
+#define STB_RECT_PACK_IMPLEMENTATION
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#elif defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4018)
+#endif
+#include "stb_rect_pack.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace graphSys {
+
+	namespace {
+		template <typename Fn>
+		void forNeighbours(const GraphStore& store, uint32_t slot, Fn&& fn)
+		{
+			for (uint32_t e = store.firstOutEdge(slot); e != GraphStore::npos; e = store.nextOutEdge(e))
+				fn(store.edgeTarget(e));
+			for (uint32_t e = store.firstInEdge(slot); e != GraphStore::npos; e = store.nextInEdge(e))
+				fn(store.edgeSrc(e));
+		}
+
+		//Breadth first over edges either way, start nodes first so the order runs out from the entrance
+		std::vector<uint32_t> breadthFirstOrder(const GraphStore& store)
+		{
+			uint32_t n = store.nodeCount();
+			std::vector<uint8_t> seen(n, 0);
+			std::vector<uint32_t> order;
+			order.reserve(n);
+
+			auto visit = [&](uint32_t root) {
+				if (seen[root])
+					return;
+				seen[root] = 1;
+				size_t head = order.size();
+				order.push_back(root);
+				while (head < order.size())
+				{
+					forNeighbours(store, order[head++], [&](uint32_t next) {
+						if (!seen[next])
+						{
+							seen[next] = 1;
+							order.push_back(next);
+						}
+					});
+				}
+			};
+
+			for (uint32_t i = 0; i < store.typeCount(types::Start); i++)
+				visit(store.nodeOfType(types::Start, i));
+			for (uint32_t slot = 0; slot < n; slot++)
+				visit(slot);
+			return order;
+		}
+	}
+
+	RoomEmbedding embedRooms(const GraphStore& store, const FootprintTable& footprints, int regionWidth, int regionHeight, uint32_t groupSize)
+	{
+		RoomEmbedding embedding;
+		uint32_t n = store.nodeCount();
+		if (n == 0)
+			return embedding;
+		groupSize = std::max(1u, groupSize);
+		const int gap = footprints.getSpacing();
+
+		//Grow each group breadth first from the earliest unassigned room, so a group is connected
+		//whenever the graph allows & consecutive groups sit next to each other in the graph
+		const uint32_t none = GraphStore::npos;
+		std::vector<uint32_t> groupOf(n, none);
+		std::vector<uint32_t> members;
+		std::vector<uint32_t> groupStart;
+		members.reserve(n);
+		for (uint32_t seed : breadthFirstOrder(store))
+		{
+			if (groupOf[seed] != none)
+				continue;
+			uint32_t group = (uint32_t)groupStart.size();
+			size_t first = members.size();
+			groupStart.push_back((uint32_t)first);
+			groupOf[seed] = group;
+			members.push_back(seed);
+			for (size_t head = first; head < members.size() && members.size() - first < groupSize; head++)
+			{
+				forNeighbours(store, members[head], [&](uint32_t next) {
+					if (groupOf[next] == none && members.size() - first < groupSize)
+					{
+						groupOf[next] = group;
+						members.push_back(next);
+					}
+				});
+			}
+		}
+		uint32_t groupCount = (uint32_t)groupStart.size();
+		groupStart.push_back((uint32_t)members.size());
+
+		//Each room carries its spacing on the right & bottom, so neighbours never touch
+		std::vector<int> roomX(n, 0), roomY(n, 0);
+		std::vector<int> boxWidth(groupCount), boxHeight(groupCount);
+		std::vector<stbrp_rect> rects;
+		std::vector<stbrp_node> packNodes;
+		stbrp_context context;
+		long long boxArea = 0, boxHeights = 0;
+		int widestBox = 0;
+
+		//Near square block per group, tall enough that every room fits
+		for (uint32_t group = 0; group < groupCount; group++)
+		{
+			rects.clear();
+			long long area = 0, height = 0;
+			int widest = 0;
+			for (uint32_t i = groupStart[group]; i < groupStart[group + 1]; i++)
+			{
+				Footprint fp = footprints.get(store.nodeType(members[i]));
+				stbrp_rect r = {};
+				r.id = (int)i;
+				r.w = fp.width + gap;
+				r.h = fp.height + gap;
+				rects.push_back(r);
+				area += (long long)r.w * r.h;
+				height += r.h;
+				widest = std::max(widest, r.w);
+			}
+
+			int binWidth = std::max(widest, (int)std::ceil(std::sqrt((double)area)));
+			packNodes.resize(std::max(packNodes.size(), (size_t)binWidth));
+			stbrp_init_target(&context, binWidth, (int)std::min(height, (long long)INT_MAX), packNodes.data(), binWidth);
+			stbrp_pack_rects(&context, rects.data(), (int)rects.size());
+
+			int w = 0, h = 0;
+			for (const stbrp_rect& r : rects)
+			{
+				uint32_t slot = members[r.id];
+				roomX[slot] = r.x;
+				roomY[slot] = r.y;
+				w = std::max(w, r.x + r.w);
+				h = std::max(h, r.y + r.h);
+			}
+			boxWidth[group] = w;
+			boxHeight[group] = h;
+			boxArea += (long long)w * h;
+			boxHeights += h;
+			widestBox = std::max(widestBox, w);
+		}
+
+		//Blocks go in one at a time in group order, the skyline takes each at its lowest leftmost
+		//spot so a block lands beside the one before it. The last room's spacing may hang past the edge
+		int width = regionWidth > 0 ? regionWidth + gap : std::max(widestBox, (int)std::ceil(std::sqrt((double)boxArea)));
+		int height = regionHeight > 0 ? regionHeight + gap : (int)std::min(boxHeights, (long long)INT_MAX);
+		std::vector<int> groupX(groupCount, 0), groupY(groupCount, 0);
+		std::vector<uint8_t> packed(groupCount, 0);
+		packNodes.resize(std::max(packNodes.size(), (size_t)width));
+		stbrp_init_target(&context, width, height, packNodes.data(), width);
+		for (uint32_t group = 0; group < groupCount; group++)
+		{
+			stbrp_rect r = {};
+			r.id = (int)group;
+			r.w = boxWidth[group];
+			r.h = boxHeight[group];
+			stbrp_pack_rects(&context, &r, 1);
+			if (!r.was_packed)
+				continue;
+			packed[group] = 1;
+			groupX[group] = r.x;
+			groupY[group] = r.y;
+		}
+
+		embedding.rooms.reserve(n);
+		for (uint32_t slot = 0; slot < n; slot++)
+		{
+			uint32_t group = groupOf[slot];
+			if (!packed[group])
+			{
+				embedding.unplaced++;
+				continue;
+			}
+			TypeAtom type = store.nodeType(slot);
+			Footprint fp = footprints.get(type);
+			RoomPlacement room = { store.nodeId(slot), type, groupX[group] + roomX[slot], groupY[group] + roomY[slot], fp.width, fp.height };
+			embedding.width = std::max(embedding.width, room.x + room.width);
+			embedding.height = std::max(embedding.height, room.y + room.height);
+			embedding.rooms.push_back(room);
+		}
+		return embedding;
+	}
+
+	void applyEmbedding(Graph& G, const RoomEmbedding& embedding)
+	{
+		const GraphStore& store = G.getStore();
+		uint32_t n = store.nodeCount();
+		std::vector<int> xs(n), ys(n);
+		for (uint32_t slot = 0; slot < n; slot++)
+		{
+			xs[slot] = store.nodeXPos(slot);
+			ys[slot] = store.nodeYPos(slot);
+		}
+		for (const RoomPlacement& room : embedding.rooms)
+		{
+			uint32_t slot = store.findNode(room.id);
+			if (slot == GraphStore::npos)
+				continue;
+			xs[slot] = room.x + room.width / 2;
+			ys[slot] = room.y + room.height / 2;
+		}
+		G.setNodePositions(xs, ys);
+	}
+}
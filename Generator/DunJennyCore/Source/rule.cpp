@@ -6,7 +6,7 @@ namespace graphSys {
 	{}
 
 	Rule::Rule(Components left, Components right)
-		: leftSide(left), rightSide(right)
+		: leftSide(std::move(left)), rightSide(std::move(right))
 	{
 	}
 
@@ -14,7 +14,7 @@ namespace graphSys {
 	{
 	}
 
-	Node Rule::getRightNodeAtId(int id)
+	Node Rule::getRightNodeAtId(int id) const
 	{
 		for (int i = 0; i < rightSide.nodes.size(); i++)
 		{
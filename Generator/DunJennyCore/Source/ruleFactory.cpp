@@ -10,10 +10,9 @@ namespace graphSys {
 	{
 	}
 
-	void RuleFactory::addNode(RuleSide s, std::string type)
+	void RuleFactory::addNode(RuleSide s, TypeAtom type)
 	{
-		
-		int uniqueID = rg.GenerateUniform(1,499);
+		int uniqueID = ruleIds.allocate();
 
 		char defaultLabel = ' ';
 		Node newNode(uniqueID, defaultLabel, type);
@@ -27,7 +26,7 @@ namespace graphSys {
 		}
 	}
 
-	void RuleFactory::addEdge(RuleSide s, Node& src, Node& target)
+	void RuleFactory::addEdge(RuleSide s, const Node& src, const Node& target)
 	{
 		Edge newEdge(src, target);
 		if (s == LEFT)
@@ -43,8 +42,8 @@ namespace graphSys {
 	void RuleFactory::createRule(std::string ruleID)
 	{
 		Rule newRule(leftSide, rightSide);
-		newRule.setID(ruleID);
-		ruleList.push_back(newRule);
+		newRule.setID(std::move(ruleID));
+		addRule(std::move(newRule));
 
 		//Clear leftSide & rightSide when added to list
 		leftSide.nodes.clear();
@@ -53,7 +52,21 @@ namespace graphSys {
 		rightSide.edges.clear();
 	}	
 
-	Rule RuleFactory::ruleAtId(std::string id)
+	void RuleFactory::addRule(Rule r)
+	{
+		compiledRules.push_back(std::make_shared<const CompiledRule>(r));
+		ruleList.push_back(std::move(r));
+	}
+
+	void RuleFactory::setRules(std::vector<Rule> newRules)
+	{
+		ruleList = std::move(newRules);
+		compiledRules.clear();
+		for (const Rule& r : ruleList)
+			compiledRules.push_back(std::make_shared<const CompiledRule>(r));
+	}
+
+	const Rule& RuleFactory::ruleAtId(const std::string& id) const
 	{		
 		for (int i = 0; i < ruleList.size(); i++)
 		{
@@ -62,105 +75,16 @@ namespace graphSys {
 				return ruleList.at(i);
 			}
 		}
+		return nullRule;
  	}
 
-	Rule RuleFactory::generateNewIds(Rule r, Graph G)
-	{
-		Rule updatedRule;
-
-		int nextId = rg.GenerateUniform(499,998);
-
-		int increment = 0;
-		std::vector<std::pair<int, int>> idPairs;
-
-		for (int i = 0; i < r.getRight().nodes.size(); i++)
-		{
-			idPairs.push_back(std::pair<int, int>(r.getRight().nodes.at(i).getID(), nextId));
-			Node n(nextId, r.getRight().nodes.at(i).getLabel(), r.getRight().nodes.at(i).getType());
-
-			updatedRule.setRight(n);
-			nextId++;
-			increment++;
-		}
-
-		for (int i = 0; i < r.getRight().edges.size(); i++)
-		{
-			Edge newEdge;
-
-			bool srcFound = false;
-			bool trgFound = false;
-			bool srcAdded = false;
-			bool trgAdded = false;
-			int it = i;
-
-			while (!srcFound || !trgFound)
-			{
-				if (r.getRight().nodes.size() == 1)
-				{
-					srcFound = true;
-					srcAdded = true;
-					trgFound = true;
-					trgAdded = true;
-				}
-				std::vector<std::pair<int, int>>::iterator itSrc;
-				std::vector<std::pair<int, int>>::iterator itTrg;
-
-				if (!srcFound)
-				{
-					itSrc = std::find_if(idPairs.begin(), idPairs.end(), [&](std::pair<int, int>) mutable { 
-						if (i < idPairs.size() && idPairs.at(i).first == r.getRight().edges.at(it).getSrc().getID())
-						{
-							srcFound = true;
-							newEdge.setSrc(updatedRule.getRightNodeAtId(idPairs.at(i).second));
-							srcAdded = true;
-							return idPairs.at(i).first == r.getRight().edges.at(it).getSrc().getID();
-						}
-					});
-				}
-
-				if (srcFound && !srcAdded)
-				{
-					newEdge.setSrc(updatedRule.getRightNodeAtId(itSrc->second));
-					srcAdded = true;
-				}
-
-				if (!trgFound)
-				{
-					itTrg = std::find_if(idPairs.begin(), idPairs.end(), [&](std::pair<int, int>) mutable {
-						if (i < idPairs.size() && idPairs.at(i).first == r.getRight().edges.at(it).getTarget().getID())
-						{
-							trgFound = true;
-							newEdge.setTarget(updatedRule.getRightNodeAtId(idPairs.at(i).second));
-							trgAdded = true;
-						}
-						else if(i < idPairs.size())
-						{
-							return idPairs.at(i).first == r.getRight().edges.at(it).getTarget().getID();
-						}});
-				}
-
-				if (trgFound && !trgAdded)
-				{
-					newEdge.setTarget(updatedRule.getRightNodeAtId(itTrg->second));
-					trgAdded = true;
-				}
-
-				i++;
-			}
-			i = it;
-
-			updatedRule.addRightEdge(newEdge);
-		}
-
-		return updatedRule;
-	}
-
 	void RuleFactory::clearRules()
 	{
 		ruleList.clear();
+		compiledRules.clear();
 	}
 
-	void RuleFactory::updateRule(Rule oldRule, Rule newRule, int side)
+	void RuleFactory::updateRule(const Rule& oldRule, const Rule& newRule, int side)
 	{
 		for (int i = 0; i < ruleList.size(); i++)
 		{
@@ -169,9 +93,6 @@ namespace graphSys {
 			{
 				if (side == 0)
 				{
-					ruleList.at(i).getLeft().nodes.clear();
-					ruleList.at(i).getLeft().edges.clear();
-
 					for (int j = 0; j < newRule.getLeft().nodes.size(); j++)
 					{	//Check that the node hasnt already been added by Node builder
 						if (currentRule.getLeftSize() > 0 && currentRule.getLeft().nodes.at(j).getID() == newRule.getLeft().nodes.at(j).getID())
@@ -189,9 +110,6 @@ namespace graphSys {
 				}
 				else if (side == 1)
 				{
-					ruleList.at(i).getLeft().nodes.clear();
-					ruleList.at(i).getLeft().edges.clear();
-
 					for (int k = 0; k < newRule.getRight().nodes.size(); k++)
 					{
 						if (currentRule.getRightSize() > 0 && currentRule.getRight().nodes.at(k).getID() == newRule.getRight().nodes.at(k).getID())
@@ -204,11 +122,12 @@ namespace graphSys {
 							ruleList.at(i).addRightEdge(newRule.getRight().edges.at(m));
 					}
 				}
+				compiledRules.at(i) = std::make_shared<const CompiledRule>(ruleList.at(i));
 			}
 		}
 	}
 
-	void RuleFactory::printRule(Rule r)
+	void RuleFactory::printRule(const Rule& r)
 	{
 		//Def strings
 		std::vector<std::string> nodeStringLeft;
@@ -233,8 +152,8 @@ namespace graphSys {
 
 		for (int i = 0; i < r.getLeft().edges.size(); i++)
 		{
-			Node src = r.getLeft().edges[i].getSrc();
-			Node target = r.getLeft().edges[i].getTarget();
+			const Node& src = r.getLeft().edges[i].getSrc();
+			const Node& target = r.getLeft().edges[i].getTarget();
 
 			std::string srcStr = std::to_string(src.getID());
 			std::string targetStr = std::to_string(target.getID());
@@ -244,8 +163,8 @@ namespace graphSys {
 
 		for (int i = 0; i < r.getRight().edges.size(); i++)
 		{
-			Node src = r.getRight().edges[i].getSrc();
-			Node target = r.getRight().edges[i].getTarget();
+			const Node& src = r.getRight().edges[i].getSrc();
+			const Node& target = r.getRight().edges[i].getTarget();
 
 			std::string srcStr = std::to_string(src.getID());
 			std::string targetStr = std::to_string(target.getID());
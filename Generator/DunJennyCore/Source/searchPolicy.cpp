@@ -0,0 +1,66 @@
+#include "searchPolicy.h"
+#include <algorithm>
+#include <cmath>
+
+namespace graphSys {
+
+	namespace {
+		//Distance of value outside the open window (low, high), scaled by high
+		double outside(int value, int low, int high)
+		{
+			double scale = std::max(1, std::abs(high));
+			if (value <= low)
+				return (low - value + 1) / scale;
+			if (value >= high)
+				return (value - high + 1) / scale;
+			return 0.0;
+		}
+	}
+
+	const char* searchModeName(SearchMode mode)
+	{
+		switch (mode)
+		{
+		case SearchMode::Annealing:
+			return "annealing";
+		case SearchMode::Beam:
+			return "beam";
+		default:
+			return "greedy";
+		}
+	}
+
+	bool searchModeFromName(const std::string& name, SearchMode& mode)
+	{
+		if (name == "greedy")
+			mode = SearchMode::Greedy;
+		else if (name == "annealing")
+			mode = SearchMode::Annealing;
+		else if (name == "beam")
+			mode = SearchMode::Beam;
+		else
+			return false;
+		return true;
+	}
+
+	double targetEnergy(Graph& G, std::pair<int, int> dist)
+	{
+		return outside(G.nodeCount(), *G.getTargetSizeMin(), *G.getTargetSizeMax()) +
+			outside(dist.first, *G.getTargetXDistMin(), *G.getTargetXDistMax()) +
+			outside(dist.second, *G.getTargetYDistMin(), *G.getTargetYDistMax());
+	}
+
+	bool meetsTargets(Graph& G, std::pair<int, int> dist)
+	{
+		return targetEnergy(G, dist) == 0.0;
+	}
+
+	bool acceptAnnealing(double before, double after, double temperature, RandomGenerator& rng)
+	{
+		if (after <= before)
+			return true;
+		if (temperature <= 0.0)
+			return false;
+		return rng.GenerateUnit() < std::exp((before - after) / temperature);
+	}
+}
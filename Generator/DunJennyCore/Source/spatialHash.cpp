@@ -0,0 +1,136 @@
+#include "spatialHash.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace graphSys {
+
+	namespace {
+		bool apart(const RoomRect& a, const RoomRect& b, int gap)
+		{
+			return std::abs(a.x - b.x) >= a.halfWidth + b.halfWidth + gap ||
+				std::abs(a.y - b.y) >= a.halfHeight + b.halfHeight + gap;
+		}
+	}
+
+	SpatialHash::SpatialHash(int cellSize)
+		: cellSize(std::max(1, cellSize))
+	{
+	}
+
+	SpatialHash::~SpatialHash()
+	{
+	}
+
+	void SpatialHash::insert(int id, const RoomRect& rect)
+	{
+		remove(id);
+		rooms.emplace(id, rect);
+		forCells(rect, [&](uint64_t k) { cells[k].push_back(id); });
+	}
+
+	void SpatialHash::remove(int id)
+	{
+		auto room = rooms.find(id);
+		if (room == rooms.end())
+			return;
+
+		forCells(room->second, [&](uint64_t k) {
+			auto cell = cells.find(k);
+			if (cell == cells.end())
+				return;
+			std::vector<int>& ids = cell->second;
+			auto it = std::find(ids.begin(), ids.end(), id);
+			if (it != ids.end())
+			{
+				*it = ids.back();
+				ids.pop_back();
+			}
+			if (ids.empty())
+				cells.erase(cell);
+		});
+		rooms.erase(room);
+	}
+
+	void SpatialHash::clear()
+	{
+		cells.clear();
+		rooms.clear();
+	}
+
+	void SpatialHash::query(const RoomRect& rect, int gap, int ignoreId, std::vector<int>& out) const
+	{
+		RoomRect grown = { rect.x, rect.y, rect.halfWidth + gap, rect.halfHeight + gap };
+		size_t first = out.size();
+		forCells(grown, [&](uint64_t k) {
+			auto cell = cells.find(k);
+			if (cell == cells.end())
+				return;
+			for (int id : cell->second)
+			{
+				if (id != ignoreId && !apart(rect, rooms.at(id), gap))
+					out.push_back(id);
+			}
+		});
+
+		//A room spanning several cells is met once per cell
+		std::sort(out.begin() + first, out.end());
+		out.erase(std::unique(out.begin() + first, out.end()), out.end());
+	}
+
+	bool SpatialHash::overlaps(const RoomRect& rect, int gap, int ignoreId) const
+	{
+		RoomRect grown = { rect.x, rect.y, rect.halfWidth + gap, rect.halfHeight + gap };
+		bool hit = false;
+		forCells(grown, [&](uint64_t k) {
+			if (hit)
+				return;
+			auto cell = cells.find(k);
+			if (cell == cells.end())
+				return;
+			for (int id : cell->second)
+			{
+				if (id != ignoreId && !apart(rect, rooms.at(id), gap))
+				{
+					hit = true;
+					return;
+				}
+			}
+		});
+		return hit;
+	}
+
+	bool SpatialHash::findFree(RoomRect& rect, int gap, int ignoreId, uint32_t tries) const
+	{
+		if (!overlaps(rect, gap, ignoreId))
+			return true;
+
+		int stepX = 2 * rect.halfWidth + gap, stepY = 2 * rect.halfHeight + gap;
+		uint32_t tried = 0;
+		for (int ring = 1; tried < tries; ring++)
+		{
+			//Walk the square ring ring steps out, one side at a time
+			for (int side = 0; side < 4; side++)
+			{
+				for (int i = -ring; i < ring && tried < tries; i++, tried++)
+				{
+					int dx = 0, dy = 0;
+					switch (side)
+					{
+					case 0: dx = i; dy = -ring; break;
+					case 1: dx = ring; dy = i; break;
+					case 2: dx = -i; dy = ring; break;
+					default: dx = -ring; dy = -i; break;
+					}
+
+					RoomRect spot = { rect.x + dx * stepX, rect.y + dy * stepY, rect.halfWidth, rect.halfHeight };
+					if (!overlaps(spot, gap, ignoreId))
+					{
+						rect = spot;
+						return true;
+					}
+				}
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,101 @@
+#include "threadPool.h"
+#include <algorithm>
+
+namespace graphSys {
+
+	ThreadPool::ThreadPool(unsigned threads)
+	{
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		for (unsigned i = 1; i < threads; i++)
+			workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		wake.notify_all();
+
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	void ThreadPool::workerLoop()
+	{
+		uint64_t seen = 0;
+		for (;;)
+		{
+			std::function<void()> current;
+			{
+				std::unique_lock<std::mutex> guard(lock);
+				wake.wait(guard, [&] { return stopping || generation != seen; });
+				if (stopping)
+					return;
+				seen = generation;
+				current = task;
+			}
+
+			try
+			{
+				current();
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				if (!failure)
+					failure = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> guard(lock);
+			if (--busy == 0)
+				done.notify_one();
+		}
+	}
+
+	void ThreadPool::parallelFor(uint32_t count, const std::function<void(uint32_t)>& body)
+	{
+		if (count == 0)
+			return;
+
+		//Indices are handed out one at a time so uneven jobs still balance
+		std::atomic<uint32_t> next(0);
+		auto drain = [&] {
+			for (uint32_t i = next++; i < count; i = next++)
+				body(i);
+		};
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			task = drain;
+			busy = (uint32_t)workers.size();
+			failure = nullptr;
+			generation++;
+		}
+		wake.notify_all();
+
+		std::exception_ptr callerFailure;
+		try
+		{
+			drain();
+		}
+		catch (...)
+		{
+			callerFailure = std::current_exception();
+			//Stop handing out work, workers finish the index they hold
+			next = count;
+		}
+
+		std::unique_lock<std::mutex> guard(lock);
+		done.wait(guard, [&] { return busy == 0; });
+		task = nullptr;
+
+		if (callerFailure)
+			std::rethrow_exception(callerFailure);
+		if (failure)
+			std::rethrow_exception(failure);
+	}
+}
@@ -0,0 +1,55 @@
+#include "typeRegistry.h"
+#include <stdexcept>
+
+namespace graphSys {
+
+	TypeRegistry::TypeRegistry()
+	{
+		const char* builtIn[] = { "room", "start", "end", "default" };
+		for (const char* name : builtIn)
+		{
+			atoms.emplace(name, (TypeAtom)names.size());
+			names.push_back(name);
+		}
+	}
+
+	TypeRegistry& TypeRegistry::instance()
+	{
+		static TypeRegistry registry;
+		return registry;
+	}
+
+	TypeAtom TypeRegistry::intern(const std::string& name)
+	{
+		TypeRegistry& reg = instance();
+		std::lock_guard<std::mutex> guard(reg.lock);
+
+		auto it = reg.atoms.find(name);
+		if (it != reg.atoms.end())
+			return it->second;
+
+		if (reg.names.size() > UINT16_MAX)
+			throw std::length_error("Too many node types registered!");
+
+		TypeAtom atom = (TypeAtom)reg.names.size();
+		reg.names.push_back(name);
+		reg.atoms.emplace(name, atom);
+		return atom;
+	}
+
+	const std::string& TypeRegistry::name(TypeAtom atom)
+	{
+		TypeRegistry& reg = instance();
+		std::lock_guard<std::mutex> guard(reg.lock);
+
+		//Names are never removed and deque growth keeps references stable
+		return reg.names.at(atom);
+	}
+
+	size_t TypeRegistry::size()
+	{
+		TypeRegistry& reg = instance();
+		std::lock_guard<std::mutex> guard(reg.lock);
+		return reg.names.size();
+	}
+}
@@ -0,0 +1,84 @@
+//Lazy deletion heaps & the extent built from them, checked against a sorted reference
+#include "testHarness.h"
+#include "extentTracker.h"
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace graphSys;
+
+TEST(extentTracker, lazyHeapMatchesMultiset)
+{
+	std::mt19937 rng(99);
+	LazyHeap<std::less<int>> heap;
+	std::multiset<int> reference;
+
+	//Enough erases to pass the compaction threshold many times over
+	for (int i = 0; i < 5000; i++)
+	{
+		if (!reference.empty() && rng() % 5 < 2)
+		{
+			auto it = reference.begin();
+			std::advance(it, rng() % reference.size());
+			heap.erase(*it);
+			reference.erase(it);
+		}
+		else
+		{
+			int value = (int)(rng() % 200) - 100;
+			heap.push(value);
+			reference.insert(value);
+		}
+
+		CHECK_EQ(heap.size(), (uint32_t)reference.size());
+		if (!reference.empty())
+			CHECK_EQ(heap.top(), *reference.rbegin());
+	}
+}
+
+TEST(extentTracker, lazyHeapAssignAndCopies)
+{
+	LazyHeap<std::greater<int>> heap;
+	heap.assign({ 5, -3, 8, -3, 12 });
+	CHECK_EQ(heap.top(), -3);
+
+	LazyHeap<std::greater<int>> copy = heap;
+	copy.erase(-3);
+	copy.erase(-3);
+	CHECK_EQ(copy.top(), 5);
+	CHECK_EQ(copy.size(), 3u);
+	CHECK_EQ(heap.top(), -3);
+	CHECK_EQ(heap.size(), 5u);
+}
+
+TEST(extentTracker, extentFollowsAddsAndRemoves)
+{
+	ExtentTracker tracker;
+	CHECK(tracker.empty());
+	CHECK_EQ(tracker.extent().maxX, 0);
+
+	tracker.add(10, -5);
+	tracker.add(-40, 30);
+	tracker.add(25, 7);
+	Extent box = tracker.extent();
+	CHECK_EQ(box.minX, -40);
+	CHECK_EQ(box.maxX, 25);
+	CHECK_EQ(box.minY, -5);
+	CHECK_EQ(box.maxY, 30);
+
+	tracker.remove(-40, 30);
+	box = tracker.extent();
+	CHECK_EQ(box.minX, 10);
+	CHECK_EQ(box.maxY, 7);
+
+	tracker.assign({ 1, 2, 3 }, { -1, -2, -3 });
+	box = tracker.extent();
+	CHECK_EQ(tracker.size(), 3u);
+	CHECK_EQ(box.minX, 1);
+	CHECK_EQ(box.maxX, 3);
+	CHECK_EQ(box.minY, -3);
+	CHECK_EQ(box.maxY, -1);
+
+	tracker.clear();
+	CHECK(tracker.empty());
+}
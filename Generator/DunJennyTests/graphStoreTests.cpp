@@ -0,0 +1,216 @@
+//Transactions on the store & the graph, a rollback must leave every slot & chain as it was
+#include "testHarness.h"
+#include "graph.h"
+
+namespace {
+	using namespace graphSys;
+
+	//Chain 1 -> 2 -> ... -> count with a branch from every third node back to node 1
+	GraphStore makeStore(int count)
+	{
+		GraphStore store;
+		for (int i = 1; i <= count; i++)
+		{
+			Node n(i, 'a' + (char)(i % 26), i % 3 == 0 ? types::End : types::Room);
+			n.setXPos(i * 10);
+			n.setYPos(-i * 5);
+			store.addNode(n);
+		}
+		for (int i = 1; i < count; i++)
+			store.addEdge(store.findNode(i), store.findNode(i + 1), types::Default);
+		for (int i = 3; i <= count; i += 3)
+			store.addEdge(store.findNode(i), store.findNode(1), types::Default, true);
+		return store;
+	}
+
+	//Walks a chain & returns the edge slots in order
+	std::vector<uint32_t> outChain(const GraphStore& store, uint32_t slot)
+	{
+		std::vector<uint32_t> chain;
+		for (uint32_t e = store.firstOutEdge(slot); e != GraphStore::npos; e = store.nextOutEdge(e))
+			chain.push_back(e);
+		return chain;
+	}
+
+	std::vector<uint32_t> inChain(const GraphStore& store, uint32_t slot)
+	{
+		std::vector<uint32_t> chain;
+		for (uint32_t e = store.firstInEdge(slot); e != GraphStore::npos; e = store.nextInEdge(e))
+			chain.push_back(e);
+		return chain;
+	}
+
+	void checkColumnLengths(const GraphStore& store)
+	{
+		const NodeColumns& nodes = store.nodeColumns();
+		uint32_t n = store.nodeCount();
+		CHECK_EQ(nodes.ids.size(), n);
+		CHECK_EQ(nodes.types.size(), n);
+		CHECK_EQ(nodes.labels.size(), n);
+		CHECK_EQ(nodes.xPos.size(), n);
+		CHECK_EQ(nodes.yPos.size(), n);
+		CHECK_EQ(nodes.firstOut.size(), n);
+		CHECK_EQ(nodes.firstIn.size(), n);
+		CHECK_EQ(nodes.typePos.size(), n);
+
+		const EdgeColumns& edges = store.edgeColumns();
+		uint32_t m = store.edgeCount();
+		CHECK_EQ(edges.src.size(), m);
+		CHECK_EQ(edges.trg.size(), m);
+		CHECK_EQ(edges.types.size(), m);
+		CHECK_EQ(edges.autoId.size(), m);
+		CHECK_EQ(edges.nextOut.size(), m);
+		CHECK_EQ(edges.prevOut.size(), m);
+		CHECK_EQ(edges.nextIn.size(), m);
+		CHECK_EQ(edges.prevIn.size(), m);
+	}
+
+	//Slot for slot, including chain order & the type buckets
+	void checkSameStore(const GraphStore& a, const GraphStore& b)
+	{
+		CHECK_EQ(a.nodeCount(), b.nodeCount());
+		CHECK_EQ(a.edgeCount(), b.edgeCount());
+		if (a.nodeCount() != b.nodeCount() || a.edgeCount() != b.edgeCount())
+			return;
+		checkColumnLengths(a);
+
+		for (uint32_t slot = 0; slot < a.nodeCount(); slot++)
+		{
+			CHECK_EQ(a.nodeId(slot), b.nodeId(slot));
+			CHECK_EQ(a.nodeType(slot), b.nodeType(slot));
+			CHECK_EQ(a.nodeLabel(slot), b.nodeLabel(slot));
+			CHECK_EQ(a.nodeXPos(slot), b.nodeXPos(slot));
+			CHECK_EQ(a.nodeYPos(slot), b.nodeYPos(slot));
+			CHECK(outChain(a, slot) == outChain(b, slot));
+			CHECK(inChain(a, slot) == inChain(b, slot));
+			CHECK_EQ(a.findNode(a.nodeId(slot)), slot);
+		}
+		for (uint32_t e = 0; e < a.edgeCount(); e++)
+		{
+			CHECK_EQ(a.edgeSrc(e), b.edgeSrc(e));
+			CHECK_EQ(a.edgeTarget(e), b.edgeTarget(e));
+			CHECK_EQ(a.edgeType(e), b.edgeType(e));
+			CHECK_EQ(a.edgeAutoID(e), b.edgeAutoID(e));
+		}
+		for (TypeAtom type : { types::Room, types::Start, types::End })
+		{
+			CHECK_EQ(a.typeCount(type), b.typeCount(type));
+			for (uint32_t i = 0; i < a.typeCount(type); i++)
+				CHECK_EQ(a.nodeType(a.nodeOfType(type, i)), type);
+		}
+	}
+}
+
+TEST(graphStore, rollbackRestoresEverySlot)
+{
+	GraphStore store = makeStore(40);
+	const GraphStore reference = makeStore(40);
+
+	store.beginTransaction();
+	for (int i = 100; i < 110; i++)
+		store.addNode(Node(i, 'z', types::Start));
+	store.addEdge(store.findNode(100), store.findNode(5), types::Default);
+	store.addEdge(store.findNode(7), store.findNode(101), types::Default);
+	//Removals from the middle swap the last node & edge into the freed slots
+	store.removeNode(store.findNode(12));
+	store.removeNode(store.findNode(1));
+	store.removeNode(store.findNode(102));
+	store.removeEdge(store.findEdge(20, 21));
+	store.setNodePosition(store.findNode(30), 999, 999);
+	CHECK(store.pendingChanges() > 0);
+	store.rollback();
+
+	CHECK(!store.inTransaction());
+	CHECK_EQ(store.pendingChanges(), (size_t)0);
+	checkSameStore(store, reference);
+	for (int i = 100; i < 110; i++)
+		CHECK_EQ(store.findNode(i), GraphStore::npos);
+}
+
+TEST(graphStore, rollbackAfterRemovingEverything)
+{
+	GraphStore store = makeStore(70);
+	const GraphStore reference = makeStore(70);
+
+	store.beginTransaction();
+	while (store.nodeCount() > 0)
+		store.removeNode(store.nodeCount() / 2);
+	CHECK_EQ(store.edgeCount(), 0u);
+	store.rollback();
+
+	checkSameStore(store, reference);
+}
+
+TEST(graphStore, commitKeepsChanges)
+{
+	GraphStore store = makeStore(10);
+
+	store.beginTransaction();
+	store.removeNode(store.findNode(4));
+	store.addNode(Node(50, 'x'));
+	store.commit();
+
+	CHECK(!store.inTransaction());
+	CHECK_EQ(store.nodeCount(), 10u);
+	CHECK_EQ(store.findNode(4), GraphStore::npos);
+	CHECK(store.findNode(50) != GraphStore::npos);
+	CHECK_EQ(store.findEdge(3, 4), GraphStore::npos);
+	CHECK_EQ(store.findEdge(4, 5), GraphStore::npos);
+
+	//Nothing is left to undo
+	store.beginTransaction();
+	store.rollback();
+	CHECK(store.findNode(50) != GraphStore::npos);
+}
+
+TEST(graphStore, graphRollbackRestoresExtentAndIds)
+{
+	Graph g;
+	for (int i = 1; i <= 5; i++)
+	{
+		Node n(i, ' ');
+		n.setXPos(i * 100);
+		n.setYPos(i * 50);
+		g.addNode(n);
+	}
+	Extent before = g.getExtent();
+	int nextId = g.getNextNodeId();
+
+	g.beginTransaction();
+	Node far(g.getNodeIds().allocate(), ' ');
+	far.setXPos(-5000);
+	far.setYPos(9000);
+	g.addNode(far);
+	std::vector<Node> gone = { g.nodeAtID(5) };
+	g.delNode(gone);
+	CHECK_EQ(g.getExtent().minX, -5000);
+	CHECK_EQ(g.getExtent().maxY, 9000);
+	g.rollback();
+
+	Extent after = g.getExtent();
+	CHECK_EQ(after.minX, before.minX);
+	CHECK_EQ(after.maxX, before.maxX);
+	CHECK_EQ(after.minY, before.minY);
+	CHECK_EQ(after.maxY, before.maxY);
+	CHECK_EQ(g.getNextNodeId(), nextId);
+	CHECK_EQ(g.nodeCount(), 5u);
+	CHECK_EQ(g.nodeAtID(5).getXPos(), 500);
+}
+
+TEST(graphStore, columnsStayAlignedOverRollbacks)
+{
+	GraphStore store = makeStore(10);
+	for (int i = 0; i < 1000; i++)
+	{
+		store.beginTransaction();
+		store.addNode(Node(1000 + i, ' '));
+		store.removeNode(store.findNode(1 + i % 10));
+		store.rollback();
+	}
+	checkColumnLengths(store);
+
+	store.removeNode(store.findNode(4));
+	store.removeNode(0);
+	checkColumnLengths(store);
+	CHECK_EQ(store.nodeCount(), 8u);
+}
@@ -0,0 +1,85 @@
+//Id index against a reference map, deletes must keep every other probe chain reachable
+#include "testHarness.h"
+#include "idIndex.h"
+#include <random>
+#include <unordered_map>
+
+namespace {
+	using namespace graphSys;
+
+	void checkAgainst(const IdIndex& index, const std::unordered_map<int, uint32_t>& reference, int maxId)
+	{
+		CHECK_EQ(index.size(), (uint32_t)reference.size());
+		for (int id = -maxId; id <= maxId; id++)
+		{
+			auto it = reference.find(id);
+			CHECK_EQ(index.find(id), it == reference.end() ? IdIndex::npos : it->second);
+		}
+	}
+}
+
+TEST(idIndex, insertFindUpdate)
+{
+	IdIndex index;
+	CHECK_EQ(index.find(7), IdIndex::npos);
+	CHECK(index.insert(7, 0));
+	CHECK(index.insert(-7, 1));
+	CHECK(!index.insert(7, 5));
+	CHECK_EQ(index.find(7), 0u);
+	index.update(7, 3);
+	CHECK_EQ(index.find(7), 3u);
+	CHECK_EQ(index.find(-7), 1u);
+	CHECK_EQ(index.size(), 2u);
+}
+
+TEST(idIndex, eraseKeepsProbeChains)
+{
+	//Dense ids fill the table to its load limit so most entries sit in shared probe chains
+	std::mt19937 rng(12345);
+	IdIndex index;
+	std::unordered_map<int, uint32_t> reference;
+	const int maxId = 600;
+
+	for (int round = 0; round < 20; round++)
+	{
+		for (int i = 0; i < 200; i++)
+		{
+			int id = (int)(rng() % (2 * maxId + 1)) - maxId;
+			uint32_t slot = rng() % 100000;
+			bool added = reference.emplace(id, slot).second;
+			CHECK_EQ(index.insert(id, slot), added);
+		}
+		for (int i = 0; i < 150; i++)
+		{
+			int id = (int)(rng() % (2 * maxId + 1)) - maxId;
+			reference.erase(id);
+			index.erase(id);
+		}
+		checkAgainst(index, reference, maxId);
+	}
+
+	//Emptying it entirely leaves no stray entry behind
+	for (int id = -maxId; id <= maxId; id++)
+		index.erase(id);
+	CHECK_EQ(index.size(), 0u);
+	reference.clear();
+	checkAgainst(index, reference, maxId);
+}
+
+TEST(idIndex, copiesAreIndependent)
+{
+	IdIndex index;
+	for (int id = 0; id < 100; id++)
+		index.insert(id, (uint32_t)id);
+
+	IdIndex copy = index;
+	for (int id = 0; id < 100; id += 2)
+		copy.erase(id);
+	copy.update(1, 500);
+
+	for (int id = 0; id < 100; id++)
+	{
+		CHECK_EQ(index.find(id), (uint32_t)id);
+		CHECK_EQ(copy.find(id), id % 2 == 0 ? IdIndex::npos : (id == 1 ? 500u : (uint32_t)id));
+	}
+}
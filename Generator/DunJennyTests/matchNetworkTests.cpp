@@ -0,0 +1,126 @@
+//Incrementally maintained matches must always equal a search of the whole graph
+#include "testHarness.h"
+#include "matchNetwork.h"
+#include "ruleFactory.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+	using namespace graphSys;
+
+	//Chain of count nodes with ids first, first + 1, ...
+	Components chain(int first, int count, TypeAtom type = types::Room)
+	{
+		Components c;
+		for (int i = 0; i < count; i++)
+			c.nodes.push_back(Node(first + i, ' ', type));
+		for (int i = 1; i < count; i++)
+			c.edges.push_back(Edge(c.nodes[i - 1], c.nodes[i]));
+		return c;
+	}
+
+	Rule makeRule(const std::string& id, Components left)
+	{
+		Rule r(std::move(left), chain(100, 2));
+		r.setID(id);
+		return r;
+	}
+
+	RuleFactory makeRules()
+	{
+		RuleFactory rf;
+		std::vector<Rule> rules;
+		rules.push_back(makeRule("single", chain(1, 1)));
+		rules.push_back(makeRule("pair", chain(1, 2)));
+		rules.push_back(makeRule("triple", chain(1, 3)));
+		rules.push_back(makeRule("endPair", chain(1, 2, types::End)));
+		rf.setRules(std::move(rules));
+		return rf;
+	}
+
+	std::vector<Match> sorted(std::vector<Match> matches)
+	{
+		std::sort(matches.begin(), matches.end());
+		return matches;
+	}
+
+	void checkMatchesFresh(const MatchNetwork& network, const std::vector<CompiledRulePtr>& rules, const GraphStore& store)
+	{
+		MatchNetwork fresh;
+		fresh.build(rules, store);
+		CHECK_EQ(network.size(), fresh.size());
+		for (size_t i = 0; i < network.size() && i < fresh.size(); i++)
+		{
+			CHECK(sorted(network.matchesOf(i)) == sorted(fresh.matchesOf(i)));
+			CHECK_EQ(network.isLive(i), fresh.isLive(i));
+		}
+	}
+}
+
+TEST(matchNetwork, updateEqualsRebuild)
+{
+	RuleFactory rf = makeRules();
+	const std::vector<CompiledRulePtr>& rules = rf.getCompiledRules();
+	std::mt19937 rng(7);
+
+	GraphStore store;
+	for (int i = 1; i <= 30; i++)
+		store.addNode(Node(i, ' ', i % 4 == 0 ? types::End : types::Room));
+	for (int i = 1; i < 30; i++)
+		store.addEdge(store.findNode(i), store.findNode(i + 1), types::Default);
+
+	MatchNetwork network;
+	network.build(rules, store);
+	checkMatchesFresh(network, rules, store);
+
+	int nextId = 31;
+	for (int step = 0; step < 200; step++)
+	{
+		store.beginTransaction();
+		//Removing a node swaps the last slot into its place, matches on that slot must follow it
+		if (store.nodeCount() > 5 && rng() % 3 == 0)
+			store.removeNode(rng() % store.nodeCount());
+		if (store.edgeCount() > 0 && rng() % 4 == 0)
+			store.removeEdge(rng() % store.edgeCount());
+		uint32_t added = store.addNode(Node(nextId++, ' ', rng() % 3 == 0 ? types::End : types::Room));
+		store.addEdge(rng() % store.nodeCount(), added, types::Default);
+		if (rng() % 2 == 0)
+			store.addEdge(added, rng() % store.nodeCount(), types::Default);
+
+		if (rng() % 5 == 0)
+		{
+			//Steps that are undone never reach the network
+			store.rollback();
+		}
+		else
+		{
+			network.update(store);
+			store.commit();
+		}
+		checkMatchesFresh(network, rules, store);
+	}
+}
+
+TEST(matchNetwork, reorderingKeepsEntriesParallel)
+{
+	RuleFactory rf = makeRules();
+	std::vector<CompiledRulePtr> rules = rf.getCompiledRules();
+
+	GraphStore store;
+	for (int i = 1; i <= 6; i++)
+		store.addNode(Node(i, ' '));
+	for (int i = 1; i < 6; i++)
+		store.addEdge(store.findNode(i), store.findNode(i + 1), types::Default);
+
+	MatchNetwork network;
+	network.build(rules, store);
+	CHECK(!network.isLive(3));
+
+	network.moveToBack(0);
+	std::rotate(rules.begin(), rules.begin() + 1, rules.end());
+	network.removeRule(1);
+	rules.erase(rules.begin() + 1);
+	checkMatchesFresh(network, rules, store);
+	CHECK_EQ(network.matchesOf(0).size(), 5u);
+	CHECK_EQ(network.matchesOf(2).size(), 6u);
+}
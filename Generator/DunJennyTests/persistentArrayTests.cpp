@@ -0,0 +1,123 @@
+//Copy-on-write arrays & the snapshots built on them, a write must never show through another copy
+#include "testHarness.h"
+#include "graph.h"
+
+namespace {
+	using namespace graphSys;
+
+	PersistentArray<int> iota(uint32_t n)
+	{
+		PersistentArray<int> a;
+		for (uint32_t i = 0; i < n; i++)
+			a.push_back((int)i);
+		return a;
+	}
+}
+
+TEST(persistentArray, pushPopAcrossChunks)
+{
+	//Small chunks so a few hundred elements cross many chunk boundaries
+	PersistentArray<int, 2> a;
+	for (int i = 0; i < 300; i++)
+		a.push_back(i);
+	CHECK_EQ(a.size(), 300u);
+	for (uint32_t i = 0; i < 300; i++)
+		CHECK_EQ(a[i], (int)i);
+
+	while (a.size() > 7)
+		a.pop_back();
+	CHECK_EQ(a.back(), 6);
+	a.push_back(42);
+	CHECK_EQ(a[7], 42);
+}
+
+TEST(persistentArray, copiesDoNotSeeWrites)
+{
+	PersistentArray<int> a = iota(200);
+	PersistentArray<int> b = a;
+
+	b.set(5, -1);
+	b.set(130, -2);
+	b.push_back(1000);
+	a.pop_back();
+	a.set(70, -3);
+
+	CHECK_EQ(a.size(), 199u);
+	CHECK_EQ(b.size(), 201u);
+	CHECK_EQ(a[5], 5);
+	CHECK_EQ(a[130], 130);
+	CHECK_EQ(a[70], -3);
+	CHECK_EQ(b[5], -1);
+	CHECK_EQ(b[130], -2);
+	CHECK_EQ(b[70], 70);
+	CHECK_EQ(b[199], 199);
+	CHECK_EQ(b[200], 1000);
+}
+
+TEST(persistentArray, assignAndClear)
+{
+	PersistentArray<int> a(130, 9);
+	PersistentArray<int> b = a;
+	a.clear();
+	CHECK(a.empty());
+	CHECK_EQ(b.size(), 130u);
+	CHECK_EQ(b[129], 9);
+	a.push_back(1);
+	CHECK_EQ(a.size(), 1u);
+}
+
+TEST(persistentArray, snapshotIsolatedFromLaterSteps)
+{
+	Graph g;
+	for (int i = 1; i <= 100; i++)
+		g.addNode(Node(i, ' '));
+	for (int i = 1; i < 100; i++)
+		g.addEdge(Edge(g.nodeAtID(i), g.nodeAtID(i + 1)));
+
+	GraphSnapshot snap = g.snapshot();
+
+	std::vector<Node> gone = { g.nodeAtID(50), g.nodeAtID(1) };
+	g.delNode(gone);
+	g.addNode(Node(500, ' '));
+	g.setNodePosition(0, 77, 77);
+
+	//A rolled back step must not reach the snapshot either
+	g.beginTransaction();
+	for (int i = 600; i < 700; i++)
+		g.addNode(Node(i, ' '));
+	g.rollback();
+
+	const GraphStore& store = snap.getStore();
+	CHECK_EQ(snap.nodeCount(), 100u);
+	CHECK_EQ(snap.edgeCount(), 99u);
+	CHECK(store.findNode(500) == GraphStore::npos);
+	for (int i = 1; i <= 100; i++)
+	{
+		uint32_t slot = store.findNode(i);
+		CHECK(slot != GraphStore::npos);
+		if (slot != GraphStore::npos)
+			CHECK_EQ(store.nodeXPos(slot), 0);
+	}
+	CHECK(store.findEdge(49, 50) != GraphStore::npos);
+	CHECK(store.findEdge(1, 2) != GraphStore::npos);
+
+	CHECK_EQ(g.nodeCount(), 99u);
+	CHECK(g.getStore().findEdge(49, 50) == GraphStore::npos);
+}
+
+TEST(persistentArray, graphCopiesAreIndependent)
+{
+	Graph a;
+	for (int i = 1; i <= 80; i++)
+		a.addNode(Node(i, ' '));
+	Graph b = a;
+
+	std::vector<Node> gone = { b.nodeAtID(3) };
+	b.delNode(gone);
+	a.addNode(Node(81, ' '));
+
+	CHECK_EQ(a.nodeCount(), 81u);
+	CHECK_EQ(b.nodeCount(), 79u);
+	CHECK(a.getStore().findNode(3) != GraphStore::npos);
+	CHECK(b.getStore().findNode(81) == GraphStore::npos);
+}
@@ -0,0 +1,44 @@
+/// \file testHarness.h
+/// \breif Registers test cases & counts failed checks, a check failing does not stop its test
+/// \author Kane White
+/// \todo
+#pragma once
+//includes
+#include <string>
+#include <sstream>
+#include <vector>
+
+//header contents
+namespace test {
+	struct Case {
+		std::string suite;
+		std::string name;
+		void (*fn)();
+	};
+
+	std::vector<Case>& registry();
+	void fail(const char* file, int line, const std::string& what);
+
+	struct Register {
+		Register(const char* suite, const char* name, void (*fn)()) { registry().push_back(Case{ suite, name, fn }); }
+	};
+
+	template<typename A, typename B>
+	void checkEqual(const A& a, const B& b, const char* as, const char* bs, const char* file, int line)
+	{
+		if (a == b)
+			return;
+		std::ostringstream what;
+		what << as << " == " << bs << " (" << a << " vs " << b << ")";
+		fail(file, line, what.str());
+	}
+}
+
+//Cases of one suite run together, ctest runs each suite as its own test
+#define TEST(suite, name) \
+	static void suite##_##name(); \
+	static test::Register suite##_##name##_register(#suite, #name, suite##_##name); \
+	static void suite##_##name()
+
+#define CHECK(cond) do { if (!(cond)) test::fail(__FILE__, __LINE__, #cond); } while (0)
+#define CHECK_EQ(a, b) test::checkEqual((a), (b), #a, #b, __FILE__, __LINE__)
@@ -0,0 +1,48 @@
+//Runs every registered case, or only those of the suite named on the command line
+#include "testHarness.h"
+#include <iostream>
+
+namespace {
+	int failures = 0;
+	const test::Case* running = nullptr;
+}
+
+namespace test {
+
+	std::vector<Case>& registry()
+	{
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	void fail(const char* file, int line, const std::string& what)
+	{
+		failures++;
+		std::cerr << file << ":" << line << ": " << running->suite << "." << running->name << " failed: " << what << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string suite = argc > 1 ? argv[1] : "";
+	int ran = 0, failed = 0;
+	for (const test::Case& c : test::registry())
+	{
+		if (!suite.empty() && c.suite != suite)
+			continue;
+		int before = failures;
+		running = &c;
+		c.fn();
+		ran++;
+		if (failures != before)
+			failed++;
+	}
+
+	if (ran == 0)
+	{
+		std::cerr << "dunjenny-tests: no tests in suite " << suite << "\n";
+		return 1;
+	}
+	std::cout << ran - failed << "/" << ran << " tests passed\n";
+	return failed == 0 ? 0 : 1;
+}
@@ -441,10 +441,11 @@ static void ShowAppLog(bool* p_open)
 
 	if (log.showGenStrat)
 	{
-		for (int i = 0; i < g_Copy.getGeneratedRules().size(); i++)
+		const std::vector<std::string>& generatedRules = g_Copy.getGeneratedRules();
+		for (int i = 0; i < generatedRules.size(); i++)
 		{
 			//Log rule
-			log.AddLog("Rule Applied: %s\n", g_Copy.getGeneratedRules().at(i).c_str());
+			log.AddLog("Rule Applied: %s\n", generatedRules.at(i).c_str());
 		}
 		log.showGenStrat = false;
 	}
@@ -540,21 +541,21 @@ void GenerateMap()
 
 	if (roomAdded)
 	{
-		graphSys::Node newNode(GetNextId(), ' ', "room");
+		graphSys::Node newNode(GetNextId(), ' ', graphSys::types::Room);
 		G.addNode(newNode);
 		nextId++;
 	}
 
 	if (startAdded)
 	{
-		graphSys::Node startNode(GetNextId(), 's', "start");
+		graphSys::Node startNode(GetNextId(), 's', graphSys::types::Start);
 		G.addNode(startNode);
 		nextId++;
 	}
 
 	if (endAdded)
 	{
-		graphSys::Node endNode(GetNextId(), 'x', "end");
+		graphSys::Node endNode(GetNextId(), 'x', graphSys::types::End);
 		G.addNode(endNode);
 		nextId++;
 	}
@@ -570,33 +571,33 @@ void GenerateMap()
 	if (G.getName() != "FAIL")
 	{
 		//Generate room nodes & update Ids to match node editor
-		for (int i = 0; i < G.getGraphNodes().size(); i++)
+		for (const graphSys::Node& graphNode : G.nodes())
 		{
-			if (G.getGraphNodes().at(i).getType() == "start")
+			if (graphNode.getType() == graphSys::types::Start)
 			{
 				node = SpawnStartNode();
-				ed::SetNodePosition(node->ID, ImVec2(G.getGraphNodes().at(i).getXPos(), G.getGraphNodes().at(i).getYPos()));
+				ed::SetNodePosition(node->ID, ImVec2(graphNode.getXPos(), graphNode.getYPos()));
 
-				int oldId = G.getGraphNodes().at(i).getID();
+				int oldId = graphNode.getID();
 				int newId = node->ID.Get();
 				ids.push_back(std::pair<int, int>(oldId, newId));
 			}
-			if (G.getGraphNodes().at(i).getType() == "room")
+			if (graphNode.getType() == graphSys::types::Room)
 			{
 				node = SpawnRoomNode();
-				ed::SetNodePosition(node->ID, ImVec2(G.getGraphNodes().at(i).getXPos(), G.getGraphNodes().at(i).getYPos()));
+				ed::SetNodePosition(node->ID, ImVec2(graphNode.getXPos(), graphNode.getYPos()));
 
-				int oldId = G.getGraphNodes().at(i).getID();
+				int oldId = graphNode.getID();
 				int newId = node->ID.Get();
 				ids.push_back(std::pair<int, int>(oldId, newId));
 
 			}
-			if (G.getGraphNodes().at(i).getType() == "end")
+			if (graphNode.getType() == graphSys::types::End)
 			{
 				node = SpawnEndNode();
-				ed::SetNodePosition(node->ID, ImVec2(G.getGraphNodes().at(i).getXPos(), G.getGraphNodes().at(i).getYPos()));
+				ed::SetNodePosition(node->ID, ImVec2(graphNode.getXPos(), graphNode.getYPos()));
 
-				int oldId = G.getGraphNodes().at(i).getID();
+				int oldId = graphNode.getID();
 				int newId = node->ID.Get();
 				ids.push_back(std::pair<int, int>(oldId, newId));
 			}
@@ -609,16 +610,17 @@ void GenerateMap()
 		BuildNodes();
 
 		//Create node links
-		for (int i = 0; i < G.getGraphEdges().size(); i++)
+		graphSys::EdgeView graphEdges = G.edges();
+		for (int i = 0; i < graphEdges.size(); i++)
 		{
-			int edgeSID = G.getGraphEdges().at(i).getSrc().getID();
-			int edgeTID = G.getGraphEdges().at(i).getTarget().getID();
+			int edgeSID = graphEdges[i].getSrc().getID();
+			int edgeTID = graphEdges[i].getTarget().getID();
 			int* srcID;
 			int* trgID;
 			int Splace = 0;
 			int Tplace = 0;
 
-			if (G.getGraphEdges().size() > 0)
+			if (graphEdges.size() > 0)
 			{
 				ids = G.getIds();
 				bool source = false;
@@ -787,8 +789,6 @@ void Application_Initialize()
 	g_Context = ed::CreateEditor(&config);
 	ed::SetCurrentEditor(g_Context);
 
-	srand(time(NULL));
-
 	s_HeaderBackground = Application_LoadTexture("Data/BlueprintBackground.png");
 	s_SaveIcon = Application_LoadTexture("Data/ic_save_white_24dp.png");
 	s_RestoreIcon = Application_LoadTexture("Data/ic_restore_white_24dp.png");
@@ -1275,7 +1275,7 @@ void OpenRuleBuilder()
 	ImGui::End();
 }
 
-void OpenDataViewer(graphSys::Graph G)
+void OpenDataViewer(const graphSys::Graph& G)
 {
 	ImGui::SetNextWindowPos(ImVec2(880, 9));
 	ImGui::SetNextWindowSize(ImVec2(820, 1000));
@@ -1293,7 +1293,8 @@ void OpenDataViewer(graphSys::Graph G)
 	ImGui::Text("Constraints"); ImGui::NextColumn();
 	ImGui::Separator();
 
-	for (int i = 0; i < gb.getGraphUpdates().size(); i++)
+	const std::vector<graphSys::GraphSnapshot>& graphUpdates = gb.getGraphUpdates();
+	for (int i = 0; i < graphUpdates.size(); i++)
 	{
 		//Convert variables into chars to use with imgui::text
 		long long genTimes = gb.graphGenTime.at(i);
@@ -1361,13 +1362,14 @@ void ShowLeftPane(float paneWidth)
 	ImGui::TextUnformatted("Available Rules");
 
 	ImGui::Indent();
-	if (gb.getRF().getRules().size() > 0)
+	const std::vector<graphSys::Rule>& availableRules = gb.getRF().getRules();
+	if (availableRules.size() > 0)
 	{
-		for (int i = 0; i < gb.getRF().getRules().size(); i++)
+		for (int i = 0; i < availableRules.size(); i++)
 		{
-			ImGui::Text(gb.getRF().getRules().at(i).getID().c_str());
+			ImGui::Text(availableRules.at(i).getID().c_str());
 
-			if (ImGui::IsItemClicked() && gb.getRF().getRules().size() > 0)
+			if (ImGui::IsItemClicked() && availableRules.size() > 0)
 			{
 				openRuleEdit = true;
 				ruleToView = i;
@@ -1543,6 +1545,85 @@ void ShowLeftPane(float paneWidth)
 	yMaxDist = dMaxY;
 	yMinDist = dMinY;
 
+	//Chains raced per generation, the first to meet the targets is kept
+	ImGui::DragInt("Parallel Chains", gb.getPortfolioChains(), 1, 1, 64, "Chains: %.0f");
+
+	//Search strategy & its parameters
+	graphSys::SearchSettings& search = gb.getSearch();
+	static int searchMode = 0;
+	ImGui::Combo("Search", &searchMode, "Greedy\0Annealing\0Beam\0\0");
+	search.mode = (graphSys::SearchMode)searchMode;
+	if (search.mode == graphSys::SearchMode::Annealing)
+	{
+		static float temperature = 0.05f;
+		static float cooling = 0.98f;
+		static float warming = 1.01f;
+		ImGui::DragFloat("Temperature", &temperature, 0.005f, 0.0f, 1.0f, "%.3f");
+		ImGui::DragFloat("Cooling", &cooling, 0.001f, 0.5f, 1.0f, "%.3f");
+		ImGui::DragFloat("Warming", &warming, 0.001f, 1.0f, 2.0f, "%.3f");
+		search.initialTemperature = temperature;
+		search.cooling = cooling;
+		search.warming = warming;
+	}
+	else if (search.mode == graphSys::SearchMode::Beam)
+	{
+		static int beamWidth = 4;
+		static int beamExpansions = 4;
+		ImGui::DragInt("Beam Width", &beamWidth, 1, 1, 32, "Width: %.0f");
+		ImGui::DragInt("Beam Expansions", &beamExpansions, 1, 1, 32, "Expansions: %.0f");
+		search.beamWidth = beamWidth;
+		search.beamExpansions = beamExpansions;
+	}
+
+	//Layout applied to the derived graph before it is placed in the editor
+	graphSys::LayoutSettings& layout = gb.getLayout();
+	static int layoutMode = 0;
+	ImGui::Combo("Layout", &layoutMode, "None\0Force\0Layered\0\0");
+	layout.mode = (graphSys::LayoutMode)layoutMode;
+	layout.threads = 0;
+	static bool avoidOverlap = false;
+	ImGui::Checkbox("Avoid Room Overlap", &avoidOverlap);
+	layout.avoidOverlap = avoidOverlap;
+	static bool incremental = false;
+	ImGui::Checkbox("Incremental Placement", &incremental);
+	layout.incremental = incremental;
+	if (incremental)
+	{
+		static int localHops = 2;
+		ImGui::DragInt("Local Hops", &localHops, 1, 0, 8, "Hops: %.0f");
+		layout.localHops = localHops;
+	}
+	if (layout.mode == graphSys::LayoutMode::Force)
+	{
+		static int layoutIterations = 100;
+		static float edgeLength = 100.0f;
+		static float theta = 1.0f;
+		ImGui::DragInt("Layout Iterations", &layoutIterations, 1, 1, 1000, "Iterations: %.0f");
+		ImGui::DragFloat("Edge Length", &edgeLength, 1.0f, 10.0f, 1000.0f, "%.0f");
+		ImGui::DragFloat("Theta", &theta, 0.01f, 0.0f, 2.0f, "%.2f");
+		layout.iterations = layoutIterations;
+		layout.edgeLength = edgeLength;
+		layout.theta = theta;
+	}
+	else if (layout.mode == graphSys::LayoutMode::Layered)
+	{
+		static int layeredSweeps = 4;
+		static float layerSpacing = 100.0f;
+		ImGui::DragInt("Crossing Sweeps", &layeredSweeps, 1, 0, 32, "Sweeps: %.0f");
+		ImGui::DragFloat("Layer Spacing", &layerSpacing, 1.0f, 10.0f, 1000.0f, "%.0f");
+		layout.layeredSweeps = layeredSweeps;
+		layout.edgeLength = layerSpacing;
+	}
+	static bool embedRooms = false;
+	ImGui::Checkbox("Pack Rooms", &embedRooms);
+	layout.embed = embedRooms;
+	if (embedRooms)
+	{
+		static int embedGroupSize = 8;
+		ImGui::DragInt("Room Group Size", &embedGroupSize, 1, 1, 64, "Group: %.0f");
+		layout.embedGroupSize = embedGroupSize;
+	}
+
 	//Variable Display -------------------------------------------------------------
 	//Graph size
 	ImGui::Separator();
@@ -2183,12 +2264,12 @@ void Application_Frame()
 		if (ImGui::MenuItem("Start"))
 		{
 			node = SpawnStartNode();
-			graphSys::Node startNode(GetNextId(), 's', "start");
+			graphSys::Node startNode(GetNextId(), 's', graphSys::types::Start);
 			gb.getGraph().addNode(startNode);
 		}
 		if (ImGui::MenuItem("End"))
 		{
-			graphSys::Node endNode(GetNextId(), 'x', "end");
+			graphSys::Node endNode(GetNextId(), 'x', graphSys::types::End);
 			gb.getGraph().addNode(endNode);
 			node = SpawnEndNode();
 		}
@@ -80,7 +80,7 @@ void GraphBuilder::testRules()
 }
 
 //Entry point for graph derivation from DunJenny.cpp
-graphSys::Graph GraphBuilder::onInit(std::vector<graphSys::Rule> existingRules, graphSys::Graph G)
+graphSys::Graph GraphBuilder::onInit(const std::vector<graphSys::Rule>& existingRules, graphSys::Graph G)
 {
 	//Load test rules
 	if (firstLoad == true)
@@ -88,14 +88,28 @@ graphSys::Graph GraphBuilder::onInit(std::vector<graphSys::Rule> existingRules,
 		testRules();
 		firstLoad = false;
 	}
-	//Instantiate generation strategy
-	graphSys::GenerationStrategy strat(rf, G, G.getIds());
-
 	preGenTime = std::chrono::high_resolution_clock::now();
 
-	if (G.getGraphNodes().size() > 0)
+	if (G.nodeCount() > 0)
 	{
-		G = strat.deriveGraph(G);
+		if (portfolioChains > 1)
+		{
+			//Race several chains and keep whichever meets the constraints first
+			portfolio.setKeepHistory(true);
+			graphSys::PortfolioResult best = portfolio.run(rf, G, portfolioChains, rng.Next(), search, 0, layout);
+			G = std::move(best.graph);
+			derivationSteps = std::move(best.history);
+		}
+		else
+		{
+			//Instantiate generation strategy
+			graphSys::GenerationStrategy strat(rf, G, G.getIds(), rng.Split());
+			strat.setSearch(search);
+			strat.setLayout(layout);
+			strat.setKeepHistory(true);
+			G = strat.deriveGraph(std::move(G));
+			derivationSteps = strat.getHistory();
+		}
 		postGenTime = std::chrono::high_resolution_clock::now();
 		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(postGenTime - preGenTime).count();
 
@@ -104,19 +118,46 @@ graphSys::Graph GraphBuilder::onInit(std::vector<graphSys::Rule> existingRules,
 		//G.graphIters.push_back(G.iteration);
 
 		if(G.getName() != "FAIL")
+		{
 			G.completed = true;
+			layoutEngine.run(G, layout);
+		}
 
 		//Update test variables
-		sizes.push_back(G.getGraphNodes().size());
+		sizes.push_back(G.nodeCount());
 		constraintsMet.push_back(G.completed);
 		iterations.push_back(G.iteration);
-		graphUpdates.push_back(G);
+		graphUpdates.push_back(G.snapshot());
 		return G;
 	}
 	else
 		return G; //deriveGraph sets graph name to "FAIL" if no solution found
 } 
 
+void GraphBuilder::generateBatch(const graphSys::BatchSettings& settings, const graphSys::Graph& G)
+{
+	//Load test rules
+	if (firstLoad == true)
+	{
+		testRules();
+		firstLoad = false;
+	}
+
+	size_t first = batch.getResults().size();
+	batch.run(rf, G, settings);
+
+	//Update test variables
+	const std::vector<graphSys::BatchResult>& results = batch.getResults();
+	for (size_t i = first; i < results.size(); i++)
+	{
+		graphGenTime.push_back(results[i].genTimeMicros / 1000);
+		sizes.push_back(results[i].size);
+		constraintsMet.push_back(results[i].success);
+		iterations.push_back(results[i].iterations);
+		graphUpdates.push_back(results[i].graph);
+	}
+}
+
 void GraphBuilder::initRule(std::string rID)
 {
 	graphSys::Rule r(left, right);
@@ -131,12 +172,12 @@ graphSys::Node GraphBuilder::addNewNode(char name, int id, std::string type)
 	nodeNames.push_back(std::pair<char*, int>(&name, id));
 	nodeName.setID(id);
 	nodeName.setLabel(name);
-	nodeName.setType(type);
+	nodeName.setType(graphSys::TypeRegistry::intern(type));
 
 	return nodeName;
 }
 
-graphSys::Edge GraphBuilder::addEdge(graphSys::Rule rule, int side, graphSys::Node src, graphSys::Node trg)
+graphSys::Edge GraphBuilder::addEdge(const graphSys::Rule& rule, int side, const graphSys::Node& src, const graphSys::Node& trg)
 {
 	graphSys::Edge edge(src, trg);
 
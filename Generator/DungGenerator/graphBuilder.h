@@ -6,6 +6,8 @@
 //includes
 #include "ruleFactory.h"
 #include "generationStrategy.h"
+#include "batchGenerator.h"
+#include "portfolioSearch.h"
 #include <chrono>
 
 //header contents
@@ -14,7 +16,20 @@ class GraphBuilder
 private:
 	graphSys::Graph G;
 	graphSys::RuleFactory rf;
-	std::vector<graphSys::Graph> graphUpdates;
+	//Each derivation gets its own stream split off this one
+	RandomGenerator rng;
+	std::vector<graphSys::GraphSnapshot> graphUpdates;
+	//Intermediate states of the most recent derivation
+	std::vector<graphSys::GraphSnapshot> derivationSteps;
+	graphSys::BatchGenerator batch;
+	//onInit races this many chains when above 1
+	graphSys::PortfolioSearch portfolio;
+	int portfolioChains = 1;
+	//Search used by onInit, single chain or raced
+	graphSys::SearchSettings search;
+	//Run on each graph onInit derives before it reaches the editor
+	graphSys::LayoutSettings layout;
+	graphSys::GraphLayout layoutEngine;
 
 
 	std::vector<std::pair<char*, int>> nodeNames;
@@ -29,13 +44,22 @@ public:
 	~GraphBuilder();
 
 	inline graphSys::Graph getGraph() { return G; }
-	inline graphSys::RuleFactory getRF() { return rf; }
-	inline void setRF(graphSys::RuleFactory nrf) { rf = nrf; }
-	inline std::vector<graphSys::Graph> getGraphUpdates() { return graphUpdates; }
-	inline std::vector<std::pair<char*, int>> getNodeNames() { return nodeNames; }
+	inline const graphSys::RuleFactory& getRF() const { return rf; }
+	inline void setRF(graphSys::RuleFactory nrf) { rf = std::move(nrf); }
+	inline void setSeed(uint64_t seed) { rng.Seed(seed); }
+	inline int* getPortfolioChains() { return &portfolioChains; }
+	inline void setPortfolioChains(int chains) { portfolioChains = chains; }
+	inline graphSys::SearchSettings& getSearch() { return search; }
+	inline graphSys::LayoutSettings& getLayout() { return layout; }
+	inline const std::vector<graphSys::GraphSnapshot>& getGraphUpdates() const { return graphUpdates; }
+	inline const std::vector<graphSys::GraphSnapshot>& getDerivationSteps() const { return derivationSteps; }
+	inline const std::vector<std::pair<char*, int>>& getNodeNames() const { return nodeNames; }
+	inline const std::vector<graphSys::BatchResult>& getBatchResults() const { return batch.getResults(); }
 
 	void testRules();
-	graphSys::Graph onInit(std::vector<graphSys::Rule> existingRules, graphSys::Graph G);
+	graphSys::Graph onInit(const std::vector<graphSys::Rule>& existingRules, graphSys::Graph G);
+	//Derive one graph per seed in parallel, the results join the test variables below
+	void generateBatch(const graphSys::BatchSettings& settings, const graphSys::Graph& G);
 
 	inline void newGraph() { G.clearGraph(); rf.clearRules(); }
 	inline void setFirstLoad(bool t) { firstLoad = t; }
@@ -43,7 +67,7 @@ public:
 
 	void initRule(std::string rID);
 	graphSys::Node addNewNode(char newNode, int id, std::string type);
-	graphSys::Edge addEdge(graphSys::Rule rule, int side, graphSys::Node src, graphSys::Node trg);
+	graphSys::Edge addEdge(const graphSys::Rule& rule, int side, const graphSys::Node& src, const graphSys::Node& trg);
 
 	graphSys::Node edgeSrc;
 	graphSys::Node edgeTrg;